@@ -281,6 +281,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(big)
         STRUCT_FOR_ID(binary_form)
         STRUCT_FOR_ID(block)
+        STRUCT_FOR_ID(buf_index)
         STRUCT_FOR_ID(buffer)
         STRUCT_FOR_ID(buffer_callback)
         STRUCT_FOR_ID(buffer_size)
@@ -378,6 +379,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(end_lineno)
         STRUCT_FOR_ID(end_offset)
         STRUCT_FOR_ID(endpos)
+        STRUCT_FOR_ID(entries)
         STRUCT_FOR_ID(entrypoint)
         STRUCT_FOR_ID(env)
         STRUCT_FOR_ID(errors)
@@ -610,6 +612,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(reload)
         STRUCT_FOR_ID(repl)
         STRUCT_FOR_ID(replace)
+        STRUCT_FOR_ID(required)
         STRUCT_FOR_ID(reserved)
         STRUCT_FOR_ID(reset)
         STRUCT_FOR_ID(resetids)
@@ -701,10 +704,12 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(unraisablehook)
         STRUCT_FOR_ID(uri)
         STRUCT_FOR_ID(usedforsecurity)
+        STRUCT_FOR_ID(user_data)
         STRUCT_FOR_ID(value)
         STRUCT_FOR_ID(values)
         STRUCT_FOR_ID(version)
         STRUCT_FOR_ID(volume)
+        STRUCT_FOR_ID(wait)
         STRUCT_FOR_ID(warnings)
         STRUCT_FOR_ID(warnoptions)
         STRUCT_FOR_ID(wbits)
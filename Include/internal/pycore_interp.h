@@ -35,8 +35,24 @@ extern "C" {
 #include "pycore_warnings.h"      // struct _warnings_runtime_state
 
 
+#ifndef WITH_FREELISTS
+// without freelists
+#  define PyLong_MAXFREELIST 0
+#endif
+
+#ifndef PyLong_MAXFREELIST
+#  define PyLong_MAXFREELIST   100
+#endif
+
 struct _Py_long_state {
     int max_str_digits;
+#if PyLong_MAXFREELIST > 0
+    /* Special free list of single-digit ints outside the small int cache.
+       free_list is a singly-linked list of available PyLongObjects,
+       linked via abuse of their ob_type members. */
+    int numfree;
+    PyLongObject *free_list;
+#endif
 };
 
 /* interpreter state */
@@ -51,6 +51,7 @@ extern "C" {
 
 extern PyStatus _PyLong_InitTypes(PyInterpreterState *);
 extern void _PyLong_FiniTypes(PyInterpreterState *interp);
+extern void _PyLong_Fini(PyInterpreterState *interp);
 
 
 /* other API */
@@ -78,9 +79,15 @@ static inline PyObject* _PyLong_FromUnsignedChar(unsigned char i)
     return Py_NewRef((PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS+i]);
 }
 
+void _PyLong_ExactDealloc(PyObject *op);
+extern void _PyLong_DebugMallocStats(FILE *out);
+
 PyObject *_PyLong_Add(PyLongObject *left, PyLongObject *right);
 PyObject *_PyLong_Multiply(PyLongObject *left, PyLongObject *right);
 PyObject *_PyLong_Subtract(PyLongObject *left, PyLongObject *right);
+PyObject *_PyLong_FloorDivide(PyLongObject *left, PyLongObject *right);
+PyObject *_PyLong_Remainder(PyLongObject *left, PyLongObject *right);
+PyObject *_PyLong_And(PyLongObject *left, PyLongObject *right);
 
 /* Used by Python/mystrtoul.c, _PyBytes_FromHex(),
    _PyBytes_DecodeEscape(), etc. */
@@ -787,6 +787,7 @@ extern "C" {
     INIT_ID(big), \
     INIT_ID(binary_form), \
     INIT_ID(block), \
+    INIT_ID(buf_index), \
     INIT_ID(buffer), \
     INIT_ID(buffer_callback), \
     INIT_ID(buffer_size), \
@@ -884,6 +885,7 @@ extern "C" {
     INIT_ID(end_lineno), \
     INIT_ID(end_offset), \
     INIT_ID(endpos), \
+    INIT_ID(entries), \
     INIT_ID(entrypoint), \
     INIT_ID(env), \
     INIT_ID(errors), \
@@ -1116,6 +1118,7 @@ extern "C" {
     INIT_ID(reload), \
     INIT_ID(repl), \
     INIT_ID(replace), \
+    INIT_ID(required), \
     INIT_ID(reserved), \
     INIT_ID(reset), \
     INIT_ID(resetids), \
@@ -1207,10 +1210,12 @@ extern "C" {
     INIT_ID(unraisablehook), \
     INIT_ID(uri), \
     INIT_ID(usedforsecurity), \
+    INIT_ID(user_data), \
     INIT_ID(value), \
     INIT_ID(values), \
     INIT_ID(version), \
     INIT_ID(volume), \
+    INIT_ID(wait), \
     INIT_ID(warnings), \
     INIT_ID(warnoptions), \
     INIT_ID(wbits), \
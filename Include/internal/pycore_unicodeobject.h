@@ -61,8 +61,17 @@ struct _Py_unicode_state {
 };
 
 extern void _PyUnicode_InternInPlace(PyInterpreterState *interp, PyObject **p);
+// Like _PyUnicode_InternInPlace(), but keep a newly interned string mortal:
+// it is removed from the interned dict when it is deallocated.
+extern void _PyUnicode_InternMortal(PyInterpreterState *interp, PyObject **p);
 extern void _PyUnicode_ClearInterned(PyInterpreterState *interp);
 
+// Return the UTF-8 representation of a string if it is available without
+// encoding (compact ASCII data or cached UTF-8), or NULL otherwise.
+extern const char* _PyUnicode_GetCachedUTF8(
+    PyObject *unicode,
+    Py_ssize_t *psize);
+
 
 #ifdef __cplusplus
 }
@@ -150,66 +150,72 @@ extern "C" {
 #define BINARY_OP_ADD_FLOAT                      6
 #define BINARY_OP_ADD_INT                        7
 #define BINARY_OP_ADD_UNICODE                    8
-#define BINARY_OP_INPLACE_ADD_UNICODE           10
-#define BINARY_OP_MULTIPLY_FLOAT                13
-#define BINARY_OP_MULTIPLY_INT                  14
-#define BINARY_OP_SUBTRACT_FLOAT                16
-#define BINARY_OP_SUBTRACT_INT                  18
-#define BINARY_SUBSCR_DICT                      19
-#define BINARY_SUBSCR_GETITEM                   20
-#define BINARY_SUBSCR_LIST_INT                  21
-#define BINARY_SUBSCR_TUPLE_INT                 22
-#define CALL_PY_EXACT_ARGS                      23
-#define CALL_PY_WITH_DEFAULTS                   24
-#define CALL_BOUND_METHOD_EXACT_ARGS            28
-#define CALL_BUILTIN_CLASS                      29
-#define CALL_BUILTIN_FAST_WITH_KEYWORDS         34
-#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS  38
-#define CALL_NO_KW_BUILTIN_FAST                 39
-#define CALL_NO_KW_BUILTIN_O                    40
-#define CALL_NO_KW_ISINSTANCE                   41
-#define CALL_NO_KW_LEN                          42
-#define CALL_NO_KW_LIST_APPEND                  43
-#define CALL_NO_KW_METHOD_DESCRIPTOR_FAST       44
-#define CALL_NO_KW_METHOD_DESCRIPTOR_NOARGS     45
-#define CALL_NO_KW_METHOD_DESCRIPTOR_O          46
-#define CALL_NO_KW_STR_1                        47
-#define CALL_NO_KW_TUPLE_1                      48
-#define CALL_NO_KW_TYPE_1                       56
-#define COMPARE_OP_FLOAT                        57
-#define COMPARE_OP_INT                          58
-#define COMPARE_OP_STR                          59
-#define FOR_ITER_LIST                           62
-#define FOR_ITER_TUPLE                          63
-#define FOR_ITER_RANGE                          64
-#define FOR_ITER_GEN                            65
-#define LOAD_SUPER_ATTR_METHOD                  66
-#define LOAD_ATTR_CLASS                         67
-#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN       70
-#define LOAD_ATTR_INSTANCE_VALUE                72
-#define LOAD_ATTR_MODULE                        73
-#define LOAD_ATTR_PROPERTY                      76
-#define LOAD_ATTR_SLOT                          77
-#define LOAD_ATTR_WITH_HINT                     78
-#define LOAD_ATTR_METHOD_LAZY_DICT              79
-#define LOAD_ATTR_METHOD_NO_DICT                80
-#define LOAD_ATTR_METHOD_WITH_VALUES            81
-#define LOAD_CONST__LOAD_FAST                   82
-#define LOAD_FAST__LOAD_CONST                   84
-#define LOAD_FAST__LOAD_FAST                    86
-#define LOAD_GLOBAL_BUILTIN                     87
-#define LOAD_GLOBAL_MODULE                      88
-#define STORE_ATTR_INSTANCE_VALUE              111
-#define STORE_ATTR_SLOT                        112
-#define STORE_ATTR_WITH_HINT                   113
-#define STORE_FAST__LOAD_FAST                  143
-#define STORE_FAST__STORE_FAST                 153
-#define STORE_SUBSCR_DICT                      154
-#define STORE_SUBSCR_LIST_INT                  158
-#define UNPACK_SEQUENCE_LIST                   159
-#define UNPACK_SEQUENCE_TUPLE                  160
-#define UNPACK_SEQUENCE_TWO_TUPLE              161
-#define SEND_GEN                               166
+#define BINARY_OP_AND_INT                       10
+#define BINARY_OP_FLOOR_DIVIDE_INT              13
+#define BINARY_OP_INPLACE_ADD_UNICODE           14
+#define BINARY_OP_LSHIFT_INT                    16
+#define BINARY_OP_MULTIPLY_FLOAT                18
+#define BINARY_OP_MULTIPLY_FLOAT_INT            19
+#define BINARY_OP_MULTIPLY_INT                  20
+#define BINARY_OP_REMAINDER_INT                 21
+#define BINARY_OP_SUBTRACT_FLOAT                22
+#define BINARY_OP_SUBTRACT_INT                  23
+#define BINARY_OP_TRUE_DIVIDE_FLOAT             24
+#define BINARY_SUBSCR_DICT                      28
+#define BINARY_SUBSCR_GETITEM                   29
+#define BINARY_SUBSCR_LIST_INT                  34
+#define BINARY_SUBSCR_TUPLE_INT                 38
+#define CALL_PY_EXACT_ARGS                      39
+#define CALL_PY_WITH_DEFAULTS                   40
+#define CALL_BOUND_METHOD_EXACT_ARGS            41
+#define CALL_BUILTIN_CLASS                      42
+#define CALL_BUILTIN_FAST_WITH_KEYWORDS         43
+#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS  44
+#define CALL_NO_KW_BUILTIN_FAST                 45
+#define CALL_NO_KW_BUILTIN_O                    46
+#define CALL_NO_KW_ISINSTANCE                   47
+#define CALL_NO_KW_LEN                          48
+#define CALL_NO_KW_LIST_APPEND                  56
+#define CALL_NO_KW_METHOD_DESCRIPTOR_FAST       57
+#define CALL_NO_KW_METHOD_DESCRIPTOR_NOARGS     58
+#define CALL_NO_KW_METHOD_DESCRIPTOR_O          59
+#define CALL_NO_KW_STR_1                        62
+#define CALL_NO_KW_TUPLE_1                      63
+#define CALL_NO_KW_TYPE_1                       64
+#define COMPARE_OP_FLOAT                        65
+#define COMPARE_OP_INT                          66
+#define COMPARE_OP_STR                          67
+#define FOR_ITER_LIST                           70
+#define FOR_ITER_TUPLE                          72
+#define FOR_ITER_RANGE                          73
+#define FOR_ITER_GEN                            76
+#define LOAD_SUPER_ATTR_METHOD                  77
+#define LOAD_ATTR_CLASS                         78
+#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN       79
+#define LOAD_ATTR_INSTANCE_VALUE                80
+#define LOAD_ATTR_MODULE                        81
+#define LOAD_ATTR_PROPERTY                      82
+#define LOAD_ATTR_SLOT                          84
+#define LOAD_ATTR_WITH_HINT                     86
+#define LOAD_ATTR_METHOD_LAZY_DICT              87
+#define LOAD_ATTR_METHOD_NO_DICT                88
+#define LOAD_ATTR_METHOD_WITH_VALUES           111
+#define LOAD_CONST__LOAD_FAST                  112
+#define LOAD_FAST__LOAD_CONST                  113
+#define LOAD_FAST__LOAD_FAST                   143
+#define LOAD_GLOBAL_BUILTIN                    153
+#define LOAD_GLOBAL_MODULE                     154
+#define STORE_ATTR_INSTANCE_VALUE              158
+#define STORE_ATTR_SLOT                        159
+#define STORE_ATTR_WITH_HINT                   160
+#define STORE_FAST__LOAD_FAST                  161
+#define STORE_FAST__STORE_FAST                 166
+#define STORE_SUBSCR_DICT                      167
+#define STORE_SUBSCR_LIST_INT                  168
+#define UNPACK_SEQUENCE_LIST                   169
+#define UNPACK_SEQUENCE_TUPLE                  170
+#define UNPACK_SEQUENCE_TWO_TUPLE              175
+#define SEND_GEN                               176
 
 #define HAS_ARG(op) ((((op) >= HAVE_ARGUMENT) && (!IS_PSEUDO_OPCODE(op)))\
     || ((op) == JUMP) \
@@ -283,3 +283,55 @@ def int_divmod(a, b):
         return ~q, b + ~r
     else:
         return _divmod_pos(a, b)
+
+
+# Toom-Cook 3-way multiplication, using the evaluation points 0, 1, -1, -2
+# and infinity and the interpolation sequence due to Marco Bodrato, "Towards
+# Optimal Toom-Cook Multiplication for Univariate and Multivariate
+# Polynomials in Characteristic 2 and 0".  Below _MUL_LIMIT bits the
+# built-in Karatsuba multiplication is used.
+
+_MUL_LIMIT = 20000
+
+
+def _toom3_pos(a, b):
+    """Multiply two nonnegative integers using Toom-3 recursively."""
+    n = max(a.bit_length(), b.bit_length())
+    if n <= _MUL_LIMIT:
+        return a * b
+    k = (n + 2) // 3
+    mask = (1 << k) - 1
+    a0, a1, a2 = a & mask, (a >> k) & mask, a >> (2 * k)
+    b0, b1, b2 = b & mask, (b >> k) & mask, b >> (2 * k)
+    # Evaluate both polynomials at 0, 1, -1, -2 and infinity.
+    p, q = a0 + a2, b0 + b2
+    pm1, qm1 = p - a1, q - b1
+    pm2, qm2 = ((pm1 + a2) << 1) - a0, ((qm1 + b2) << 1) - b0
+    r0 = _toom3_pos(a0, b0)
+    r1 = _toom3_pos(p + a1, q + b1)
+    rm1 = _toom3(pm1, qm1)
+    rm2 = _toom3(pm2, qm2)
+    rinf = _toom3_pos(a2, b2)
+    # Interpolate.  All divisions are exact.
+    r3 = (rm2 - r1) // 3
+    r1 = (r1 - rm1) >> 1
+    r2 = rm1 - r0
+    r3 = ((r2 - r3) >> 1) + (rinf << 1)
+    r2 = r2 + r1 - rinf
+    r1 = r1 - r3
+    return (r0 + (r1 << k) + (r2 << (2 * k)) + (r3 << (3 * k))
+            + (rinf << (4 * k)))
+
+
+def _toom3(a, b):
+    """Helper function for _toom3_pos accepting integers of any sign."""
+    if (a < 0) != (b < 0):
+        return -_toom3_pos(abs(a), abs(b))
+    return _toom3_pos(abs(a), abs(b))
+
+
+def int_mul(a, b):
+    """Asymptotically fast replacement for a * b, for 'int'.
+    Its time complexity is O(n**1.47), where n = #bits(a) + #bits(b).
+    """
+    return _toom3(a, b)
@@ -871,7 +871,13 @@ def copyfile(self, source, outputfile):
         to copy binary data as well.
 
         """
-        shutil.copyfileobj(source, outputfile)
+        if (isinstance(outputfile, socketserver._SocketWriter)
+                and isinstance(source, io.BufferedReader)):
+            # The output isn't buffered: let the kernel send the file
+            offset = source.tell() if source.seekable() else 0
+            outputfile._sock.sendfile(source, offset)
+        else:
+            shutil.copyfileobj(source, outputfile)
 
     def guess_type(self, path):
         """Guess the type of a file.
@@ -97,13 +97,13 @@
 """
 __version__ = '2.0.9'
 __all__ = [
-    'dump', 'dumps', 'load', 'loads', 'AttrDict',
-    'JSONDecoder', 'JSONDecodeError', 'JSONEncoder',
+    'dump', 'dumps', 'load', 'loads', 'iterload', 'AttrDict',
+    'JSONDecoder', 'JSONDecodeError', 'JSONEncoder', 'JSONStreamDecoder',
 ]
 
 __author__ = 'Bob Ippolito <bob@redivi.com>'
 
-from .decoder import JSONDecoder, JSONDecodeError
+from .decoder import JSONDecoder, JSONDecodeError, JSONStreamDecoder
 from .encoder import JSONEncoder
 import codecs
 
@@ -338,11 +338,17 @@ def loads(s, *, cls=None, object_hook=None, parse_float=None,
         if not isinstance(s, (bytes, bytearray)):
             raise TypeError(f'the JSON object must be str, bytes or bytearray, '
                             f'not {s.__class__.__name__}')
-        s = s.decode(detect_encoding(s), 'surrogatepass')
+        encoding = detect_encoding(s)
+        # UTF-8 bytes are parsed directly by JSONDecoder, unless they can be
+        # mutated while parsing.
+        if encoding != 'utf-8' or cls is not None or type(s) is not bytes:
+            s = s.decode(encoding, 'surrogatepass')
 
     if (cls is None and object_hook is None and
             parse_int is None and parse_float is None and
             parse_constant is None and object_pairs_hook is None and not kw):
+        if isinstance(s, bytes):
+            return _default_decoder._decode_utf8(s)
         return _default_decoder.decode(s)
     if cls is None:
         cls = JSONDecoder
@@ -356,8 +362,44 @@ def loads(s, *, cls=None, object_hook=None, parse_float=None,
         kw['parse_int'] = parse_int
     if parse_constant is not None:
         kw['parse_constant'] = parse_constant
+    if isinstance(s, bytes):
+        return cls(**kw)._decode_utf8(s)
     return cls(**kw).decode(s)
 
+def iterload(fp, *, items=False, cls=None, object_hook=None,
+        parse_float=None, parse_int=None, parse_constant=None,
+        object_pairs_hook=None, **kw):
+    """Deserialize ``fp`` (a ``.read()``-supporting file-like object
+    containing a stream of JSON documents) and yield each document as soon
+    as it is read.
+
+    The documents are separated by optional whitespace, such as in
+    newline-delimited JSON.  If ``items`` is true, ``fp`` must contain a
+    single JSON array, and its elements are yielded instead.  Only the text
+    of one document or element is held in memory at a time.
+
+    The other arguments have the same meaning as in ``load()``.
+    """
+    if cls is None:
+        cls = JSONDecoder
+    if object_hook is not None:
+        kw['object_hook'] = object_hook
+    if object_pairs_hook is not None:
+        kw['object_pairs_hook'] = object_pairs_hook
+    if parse_float is not None:
+        kw['parse_float'] = parse_float
+    if parse_int is not None:
+        kw['parse_int'] = parse_int
+    if parse_constant is not None:
+        kw['parse_constant'] = parse_constant
+    decoder = JSONStreamDecoder(cls(**kw), items=items)
+    while chunk := fp.read(_ITERLOAD_CHUNK_SIZE):
+        yield from decoder.feed(chunk)
+    yield from decoder.close()
+
+_ITERLOAD_CHUNK_SIZE = 64 * 1024
+
+
 class AttrDict(dict):
     """Dict like object that supports attribute style dotted access.
 
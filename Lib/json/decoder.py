@@ -8,7 +8,7 @@
 except ImportError:
     c_scanstring = None
 
-__all__ = ['JSONDecoder', 'JSONDecodeError']
+__all__ = ['JSONDecoder', 'JSONDecodeError', 'JSONStreamDecoder']
 
 FLAGS = re.VERBOSE | re.MULTILINE | re.DOTALL
 
@@ -131,6 +131,7 @@ def py_scanstring(s, end, strict=True,
 
 WHITESPACE = re.compile(r'[ \t\n\r]*', FLAGS)
 WHITESPACE_STR = ' \t\n\r'
+WHITESPACE_BYTES = re.compile(rb'[ \t\n\r]*')
 
 
 def JSONObject(s_and_end, strict, scan_once, object_hook, object_pairs_hook,
@@ -340,6 +341,21 @@ def decode(self, s, _w=WHITESPACE.match):
             raise JSONDecodeError("Extra data", s, end)
         return obj
 
+    def _decode_utf8(self, b, _w=WHITESPACE_BYTES.match):
+        # Like decode(), for a bytes object holding UTF-8.  The C scanner
+        # parses it without decoding the whole document to str first.
+        if (scanner.c_make_scanner is None or
+                not isinstance(self.scan_once, scanner.c_make_scanner)):
+            return self.decode(b.decode('utf-8', 'surrogatepass'))
+        try:
+            obj, end = self.scan_once(b, _w(b, 0).end())
+        except StopIteration:
+            end = -1
+        if end == -1 or _w(b, end).end() != len(b):
+            # Raise the same error as decode()
+            return self.decode(b.decode('utf-8', 'surrogatepass'))
+        return obj
+
     def raw_decode(self, s, idx=0):
         """Decode a JSON document from ``s`` (a ``str`` beginning with
         a JSON document) and return a 2-tuple of the Python
@@ -354,3 +370,296 @@ def raw_decode(self, s, idx=0):
         except StopIteration as err:
             raise JSONDecodeError("Expecting value", s, err.value) from None
         return obj, end
+
+
+# Used by JSONStreamDecoder to find where values end without decoding them.
+STRUCTURE = re.compile(r'[\[\]{}",]')
+STRINGREST = re.compile(r'[^"\\]*(?:\\.[^"\\]*)*', FLAGS)
+SCALAR = re.compile(r'[^ \t\n\r\[\]{}",]*')
+
+# Position of a JSONStreamDecoder in the top-level array with items=True
+_BEFORE_ARRAY, _FIRST_ITEM, _NEXT_ITEM, _AFTER_ARRAY = range(4)
+
+
+class JSONStreamDecoder(object):
+    """Incremental decoder for a stream of JSON documents.
+
+    Data is passed to feed() in chunks of any size as it arrives, and each
+    call returns the list of the values which were completed by the chunk.
+    close() must be called at the end of the stream.  Only the text of the
+    value being decoded is held in memory.
+
+    By default the stream is a sequence of JSON documents separated by
+    optional whitespace, such as newline-delimited JSON.  If *items* is
+    true, the stream must hold a single JSON array, and its elements are
+    returned one by one instead.
+
+    Values are decoded with *decoder*, a JSONDecoder instance.
+
+    """
+    def __init__(self, decoder=None, *, items=False):
+        self.decoder = decoder if decoder is not None else JSONDecoder()
+        self.items = items
+        self._buf = ''
+        self._pos = 0           # where the scan of _buf resumes
+        self._start = None      # start of the current value in _buf
+        self._depth = 0
+        self._in_string = False
+        self._array = _BEFORE_ARRAY
+        # Undecoded bytes and their decoder, if bytes are fed
+        self._bytes = None
+        self._textdecoder = None
+        # Amount of text already discarded from the stream
+        self._offset = 0
+        self._lineno = 1
+        self._colno = 0
+
+    def feed(self, data):
+        """Add data, a str or bytes, to the stream.
+
+        Return the list of the values completed by data.
+        """
+        return self._feed(data, False)
+
+    def close(self):
+        """Signal the end of the stream.
+
+        Return the list of the last values, and raise JSONDecodeError if
+        the stream ends with an incomplete value.
+        """
+        values = self._feed(b'' if self._bytes is not None else '', True)
+        try:
+            self._finish()
+        except JSONDecodeError as err:
+            raise self._adjust(err) from None
+        return values
+
+    def _feed(self, data, final):
+        if isinstance(data, str):
+            if self._bytes is not None:
+                raise TypeError('cannot mix str and bytes in a JSON stream')
+        else:
+            if not isinstance(data, (bytes, bytearray)):
+                raise TypeError(f'the JSON stream must be fed str, bytes or '
+                                f'bytearray, not {data.__class__.__name__}')
+            if self._bytes is None:
+                if self._buf or self._offset:
+                    raise TypeError('cannot mix str and bytes in a '
+                                    'JSON stream')
+                self._bytes = b''
+            data = self._decode_bytes(data, final)
+        # Drop the attribute's reference so that the str can be resized in
+        # place by the concatenation.
+        buf = self._buf
+        self._buf = None
+        buf += data
+        self._buf = buf
+        try:
+            return self._process(final)
+        except JSONDecodeError as err:
+            raise self._adjust(err) from None
+
+    def _decode_bytes(self, data, final):
+        if self._textdecoder is None:
+            # Wait for enough bytes to detect the encoding as loads() does
+            self._bytes += data
+            if len(self._bytes) < 4 and not final:
+                return ''
+            from json import detect_encoding
+            import codecs
+            encoding = detect_encoding(self._bytes)
+            self._textdecoder = codecs.getincrementaldecoder(encoding)(
+                'surrogatepass')
+            data, self._bytes = self._bytes, b''
+        return self._textdecoder.decode(data, final)
+
+    def _process(self, final, _w=WHITESPACE.match):
+        buf = self._buf
+        values = []
+        speculate = self._can_speculate()
+        while True:
+            if self._start is None:
+                pos = self._pos
+                if not self.items or self._array != _NEXT_ITEM:
+                    pos = _w(buf, pos).end()
+                if self.items:
+                    if self._array == _BEFORE_ARRAY:
+                        if pos == len(buf):
+                            self._pos = pos
+                            break
+                        if buf[pos] != '[':
+                            raise JSONDecodeError("Expecting '['", buf, pos)
+                        pos += 1
+                        self._array = _FIRST_ITEM
+                    elif self._array == _AFTER_ARRAY:
+                        if pos != len(buf):
+                            raise JSONDecodeError("Extra data", buf, pos)
+                        self._pos = pos
+                        break
+                elif pos == len(buf):
+                    self._pos = pos
+                    break
+                elif buf[pos] not in '[{"':
+                    # Scalars end at the first character which can't be
+                    # part of them.
+                    end = SCALAR.match(buf, pos).end()
+                    if end == len(buf) and not final:
+                        self._pos = pos
+                        break
+                    values.append(self._decode_value(buf, pos, end))
+                    self._pos = end
+                    continue
+                self._start = self._pos = pos
+                self._depth = 0
+                if speculate and self._decode_complete(buf, values):
+                    continue
+            end = self._scan_nested(buf, self._pos)
+            if end is None:
+                break
+            if self.items:
+                self._decode_item(buf, end, values)
+                self._pos = end + 1
+            else:
+                values.append(self._decode_value(buf, self._start, end))
+                self._pos = end
+            self._start = None
+        self._discard(self._pos if self._start is None else self._start)
+        return values
+
+    def _can_speculate(self):
+        # Decoding a value before its end is known is only safe if the
+        # decoder runs no user code: hooks would be called on parts of an
+        # incomplete value, and called again once it is complete.
+        decoder = self.decoder
+        return (type(decoder) is JSONDecoder
+                and decoder.object_hook is None
+                and decoder.object_pairs_hook is None
+                and decoder.parse_float is float
+                and decoder.parse_int is int
+                and decoder.parse_constant == _CONSTANTS.__getitem__)
+
+    def _decode_complete(self, buf, values, _w=WHITESPACE.match):
+        # Most values are already complete in the buffer: try to decode the
+        # current value directly, and return false if it may be incomplete.
+        # It is then scanned for its end as more data arrives, and only
+        # decoded once complete.  Only used if _can_speculate() is true.
+        start = self._start
+        if self.items:
+            start = _w(buf, start).end()
+        try:
+            obj, end = self.decoder.raw_decode(buf, start)
+        except JSONDecodeError:
+            return False
+        if self.items:
+            end = _w(buf, end).end()
+            if end == len(buf) or buf[end] not in ',]':
+                return False
+            self._array = _AFTER_ARRAY if buf[end] == ']' else _NEXT_ITEM
+            end += 1
+        values.append(obj)
+        self._start = None
+        self._pos = end
+        return True
+
+    def _scan_nested(self, buf, pos):
+        # Return the end of the current container or top-level string, or
+        # the position of the delimiter which ends the current item.  Return
+        # None if more data is needed.
+        depth = self._depth
+        items = self.items
+        while True:
+            if self._in_string:
+                pos = STRINGREST.match(buf, pos).end()
+                if pos == len(buf) or buf[pos] != '"':
+                    # Possibly a trailing backslash
+                    break
+                self._in_string = False
+                pos += 1
+                if depth == 0 and not items:
+                    return pos
+            m = STRUCTURE.search(buf, pos)
+            if m is None:
+                pos = len(buf)
+                break
+            pos = m.start()
+            c = buf[pos]
+            if c == '"':
+                self._in_string = True
+                pos += 1
+            elif c == '[' or c == '{':
+                depth += 1
+                pos += 1
+            elif items and depth == 0:
+                return pos
+            elif c == ',':
+                pos += 1
+            else:
+                depth -= 1
+                pos += 1
+                if depth == 0 and not items:
+                    return pos
+        self._pos = pos
+        self._depth = depth
+        return None
+
+    def _decode_value(self, buf, start, end):
+        obj, pos = self.decoder.raw_decode(buf, start)
+        if pos != end:
+            raise JSONDecodeError("Extra data", buf, pos)
+        return obj
+
+    def _decode_item(self, buf, end, values, _w=WHITESPACE.match):
+        # Decode the item in buf[self._start:end], which is followed by the
+        # delimiter buf[end].
+        delimiter = buf[end]
+        idx = _w(buf, self._start).end()
+        if idx == end:
+            if delimiter == ']' and self._array == _FIRST_ITEM:
+                self._array = _AFTER_ARRAY
+                return
+            raise JSONDecodeError("Expecting value", buf, end)
+        obj, pos = self.decoder.raw_decode(buf, idx)
+        pos = _w(buf, pos).end()
+        if pos != end or delimiter == '}':
+            raise JSONDecodeError("Expecting ',' delimiter", buf, pos)
+        values.append(obj)
+        self._array = _AFTER_ARRAY if delimiter == ']' else _NEXT_ITEM
+
+    def _finish(self, _w=WHITESPACE.match):
+        # Raise the error that loads() would raise on the unfinished value
+        buf = self._buf
+        if self._start is not None:
+            pos = _w(buf, self._start).end()
+            if self.items and pos == len(buf):
+                raise JSONDecodeError("Expecting value", buf, pos)
+            pos = _w(buf, self.decoder.raw_decode(buf, pos)[1]).end()
+            raise JSONDecodeError("Expecting ',' delimiter", buf, pos)
+        if self.items and self._array == _BEFORE_ARRAY:
+            raise JSONDecodeError("Expecting value", buf, len(buf))
+
+    def _discard(self, n):
+        # Drop buf[:n], keeping track of its position in the stream
+        if n:
+            text = self._buf[:n]
+            newlines = text.count('\n')
+            if newlines:
+                self._lineno += newlines
+                self._colno = n - text.rfind('\n') - 1
+            else:
+                self._colno += n
+            self._offset += n
+            self._buf = self._buf[n:]
+            self._pos -= n
+            if self._start is not None:
+                self._start -= n
+
+    def _adjust(self, err):
+        # Make the position of err relative to the start of the stream
+        if self._offset:
+            if err.lineno == 1:
+                err.colno += self._colno
+            err.lineno += self._lineno - 1
+            err.pos += self._offset
+            err.args = ('%s: line %d column %d (char %d)' %
+                        (err.msg, err.lineno, err.colno, err.pos),)
+        return err
@@ -311,11 +311,17 @@ def pseudo_op(name, op, real_ops):
         "BINARY_OP_ADD_FLOAT",
         "BINARY_OP_ADD_INT",
         "BINARY_OP_ADD_UNICODE",
+        "BINARY_OP_AND_INT",
+        "BINARY_OP_FLOOR_DIVIDE_INT",
         "BINARY_OP_INPLACE_ADD_UNICODE",
+        "BINARY_OP_LSHIFT_INT",
         "BINARY_OP_MULTIPLY_FLOAT",
+        "BINARY_OP_MULTIPLY_FLOAT_INT",
         "BINARY_OP_MULTIPLY_INT",
+        "BINARY_OP_REMAINDER_INT",
         "BINARY_OP_SUBTRACT_FLOAT",
         "BINARY_OP_SUBTRACT_INT",
+        "BINARY_OP_TRUE_DIVIDE_FLOAT",
     ],
     "BINARY_SUBSCR": [
         "BINARY_SUBSCR_DICT",
@@ -462,6 +462,38 @@ def _get_literal_prefix(pattern, flags):
         return prefix, prefix_skip, True
     return prefix, prefix_skip, False
 
+def _get_literal_runs(pattern, flags, runs):
+    # collect the runs of consecutive literal characters that every
+    # match of pattern consumes; the last run is left open so that
+    # it can continue past the end of a group
+    iscased = _get_iscased(flags)
+    for op, av in pattern.data:
+        if op is LITERAL and not (iscased and iscased(av)):
+            runs[-1].append(av)
+        elif op is SUBPATTERN:
+            group, add_flags, del_flags, p = av
+            flags1 = _combine_flags(flags, add_flags, del_flags)
+            if flags1 & SRE_FLAG_IGNORECASE and flags1 & SRE_FLAG_LOCALE:
+                runs.append([])
+            else:
+                _get_literal_runs(p, flags1, runs)
+        elif runs[-1]:
+            runs.append([])
+
+def _get_required_literal(pattern, flags):
+    # look for the longest literal that any match must contain.  the
+    # search engine uses it to give up early on subjects that do not
+    # contain it; a literal prefix is already handled by the info block
+    if flags & SRE_FLAG_IGNORECASE and flags & SRE_FLAG_LOCALE:
+        return None
+    runs = [[]]
+    _get_literal_runs(pattern, flags, runs)
+    required = max(runs, key=len)
+    prefix, prefix_skip, got_all = _get_literal_prefix(pattern, flags)
+    if len(required) <= len(prefix):
+        return None
+    return required
+
 def _get_charset_prefix(pattern, flags):
     while True:
         if not pattern.data:
@@ -756,8 +788,18 @@ def compile(p, flags=0):
     for k, i in groupindex.items():
         indexgroup[i] = k
 
+    required = None
+    if pattern is not None:
+        literal = _get_required_literal(p, flags | p.state.flags)
+        if literal is not None:
+            if isinstance(pattern, str):
+                required = ''.join(map(chr, literal))
+            else:
+                required = bytes(literal)
+
     return _sre.compile(
         pattern, flags | p.state.flags, code,
         p.state.groups-1,
-        groupindex, tuple(indexgroup)
+        groupindex, tuple(indexgroup),
+        required
         )
@@ -4,6 +4,7 @@
 
 """
 
+import io
 import os
 import sys
 import stat
@@ -47,6 +48,8 @@
 # This should never be removed, see rationale in:
 # https://bugs.python.org/issue43743#msg393429
 _USE_CP_SENDFILE = hasattr(os, "sendfile") and sys.platform.startswith("linux")
+_USE_CP_COPY_FILE_RANGE = hasattr(os, "copy_file_range")
+_USE_CP_SPLICE = hasattr(os, "splice")
 _HAS_FCOPYFILE = posix and hasattr(posix, "_fcopyfile")  # macOS
 
 # CMD defaults in Windows 10
@@ -107,30 +110,11 @@ def _fastcopy_fcopyfile(fsrc, fdst, flags):
         else:
             raise err from None
 
-def _fastcopy_sendfile(fsrc, fdst):
-    """Copy data from one regular mmap-like fd to another by using
-    high-performance sendfile(2) syscall.
-    This should work on Linux >= 2.6.33 only.
-    """
-    # Note: copyfileobj() is left alone in order to not introduce any
-    # unexpected breakage. Possible risks by using zero-copy calls
-    # in copyfileobj() are:
-    # - fdst cannot be open in "a"(ppend) mode
-    # - fsrc and fdst may be open in "t"(ext) mode
-    # - fsrc may be a BufferedReader (which hides unread data in a buffer),
-    #   GzipFile (which decompresses data), HTTPResponse (which decodes
-    #   chunks).
-    # - possibly others (e.g. encrypted fs/partition?)
-    global _USE_CP_SENDFILE
-    try:
-        infd = fsrc.fileno()
-        outfd = fdst.fileno()
-    except Exception as err:
-        raise _GiveupOnFastCopy(err)  # not a regular file
-
+def _determine_linux_fastcopy_blocksize(infd):
+    """Determine the block size for zero-copy calls on Linux."""
     # Hopefully the whole file will be copied in a single call.
-    # sendfile() is called in a loop 'till EOF is reached (0 return)
-    # so a bufsize smaller or bigger than the actual file size
+    # The zero-copy syscall is called in a loop 'till EOF is reached
+    # (0 return) so a bufsize smaller or bigger than the actual file size
     # should not make any difference, also in case the file content
     # changes while being copied.
     try:
@@ -141,7 +125,61 @@ def _fastcopy_sendfile(fsrc, fdst):
     # see bpo-38319.
     if sys.maxsize < 2 ** 32:
         blocksize = min(blocksize, 2 ** 30)
+    return blocksize
 
+def _fastcopy_copy_file_range(fsrc, fdst):
+    """Copy data from one regular file to another by using the
+    copy_file_range(2) syscall, which lets the filesystem share the
+    extents (reflink) or copy them on the server side.
+    This should work on Linux >= 4.5 only.
+    """
+    try:
+        infd = fsrc.fileno()
+        outfd = fdst.fileno()
+    except Exception as err:
+        raise _GiveupOnFastCopy(err)  # not a regular file
+
+    blocksize = _determine_linux_fastcopy_blocksize(infd)
+    offset = 0
+    while True:
+        try:
+            copied = os.copy_file_range(infd, outfd, blocksize,
+                                        offset_src=offset)
+        except OSError as err:
+            # ...in order to have a more informative exception.
+            err.filename = fsrc.name
+            err.filename2 = fdst.name
+
+            if err.errno == errno.ENOSPC:  # filesystem is full
+                raise err from None
+
+            # Give up on first call and if no data was copied.
+            if offset == 0 and os.lseek(outfd, 0, os.SEEK_CUR) == 0:
+                raise _GiveupOnFastCopy(err)
+
+            raise err
+        else:
+            if copied == 0:
+                # Some filesystems (e.g. procfs) report 0 for files
+                # which do have content: let read() decide.
+                if offset == 0:
+                    raise _GiveupOnFastCopy()
+                break  # EOF
+            offset += copied
+
+def _fastcopy_sendfile(fsrc, fdst):
+    """Copy data from one regular mmap-like fd to another by using
+    high-performance sendfile(2) syscall.
+    This should work on Linux >= 2.6.33 only.
+    """
+    global _USE_CP_SENDFILE
+    try:
+        infd = fsrc.fileno()
+        outfd = fdst.fileno()
+    except Exception as err:
+        raise _GiveupOnFastCopy(err)  # not a regular file
+
+    blocksize = _determine_linux_fastcopy_blocksize(infd)
     offset = 0
     while True:
         try:
@@ -191,8 +229,75 @@ def _copyfileobj_readinto(fsrc, fdst, length=COPY_BUFSIZE):
             else:
                 fdst_write(mv)
 
+# Exact types whose data is the data of their file descriptor, once the
+# buffers are drained.  Subclasses, text files, GzipFile, sockets and so
+# on can transform the data and are copied through read() and write().
+_FASTCOPY_READERS = (io.FileIO, io.BufferedReader, io.BufferedRandom)
+_FASTCOPY_WRITERS = (io.FileIO, io.BufferedWriter, io.BufferedRandom)
+
+def _fastcopy_fileobj(fsrc, fdst):
+    """Copy the rest of fsrc to fdst through their file descriptors with
+    the best zero-copy syscall for the pair: copy_file_range(2) between
+    regular files, sendfile(2) from a regular file and splice(2) from or
+    to a pipe.  Both file positions are advanced.
+    """
+    if type(fsrc) not in _FASTCOPY_READERS or type(fdst) not in _FASTCOPY_WRITERS:
+        raise _GiveupOnFastCopy()
+    try:
+        raws = [f.raw for f in (fsrc, fdst) if type(f) is not io.FileIO]
+        infd = fsrc.fileno()
+        outfd = fdst.fileno()
+        inst = os.fstat(infd)
+        outmode = os.fstat(outfd).st_mode
+    except Exception as err:
+        raise _GiveupOnFastCopy(err)
+    if any(type(raw) is not io.FileIO for raw in raws):
+        raise _GiveupOnFastCopy()
+    if 'a' in fdst.mode:
+        raise _GiveupOnFastCopy()  # zero-copy calls refuse O_APPEND
+    inmode = inst.st_mode
+    if stat.S_ISREG(inmode) and inst.st_size <= COPY_BUFSIZE:
+        raise _GiveupOnFastCopy()  # a single read() is cheaper
+
+    if stat.S_ISREG(inmode) and stat.S_ISREG(outmode) and _USE_CP_COPY_FILE_RANGE:
+        call = os.copy_file_range
+    elif stat.S_ISREG(inmode) and _USE_CP_SENDFILE:
+        call = lambda infd, outfd, blocksize: os.sendfile(outfd, infd, None,
+                                                           blocksize)
+    elif (stat.S_ISFIFO(inmode) or stat.S_ISFIFO(outmode)) and _USE_CP_SPLICE:
+        call = os.splice
+    else:
+        raise _GiveupOnFastCopy()
+
+    # Hand the data hidden in the buffers to the destination first, so
+    # that the file positions are those of the descriptors.
+    if type(fsrc) is not io.FileIO:
+        if data := fsrc.read1(len(fsrc.peek(1))):
+            fdst.write(data)
+    if type(fdst) is not io.FileIO:
+        fdst.flush()
+
+    blocksize = _determine_linux_fastcopy_blocksize(infd)
+    try:
+        while call(infd, outfd, blocksize):
+            pass
+    except OSError:
+        # A failed call transfers nothing: read() and write() carry on
+        # from the current positions, and report errors that are not
+        # specific to the zero-copy call.
+        pass
+    finally:
+        # Resynchronize the buffered objects with their descriptor.
+        for f in fsrc, fdst:
+            if type(f) is not io.FileIO and f.seekable():
+                f.seek(0, os.SEEK_CUR)
+
 def copyfileobj(fsrc, fdst, length=0):
     """copy data from file-like object fsrc to file-like object fdst"""
+    try:
+        _fastcopy_fileobj(fsrc, fdst)
+    except _GiveupOnFastCopy:
+        pass
     if not length:
         length = COPY_BUFSIZE
     # Localize variable access to minimize overhead.
@@ -267,6 +372,14 @@ def copyfile(src, dst, *, follow_symlinks=True):
                             pass
                     # Linux
                     elif _USE_CP_SENDFILE:
+                        # copy_file_range() may share the extents instead
+                        # of copying them.
+                        if _USE_CP_COPY_FILE_RANGE:
+                            try:
+                                _fastcopy_copy_file_range(fsrc, fdst)
+                                return dst
+                            except _GiveupOnFastCopy:
+                                pass
                         try:
                             _fastcopy_sendfile(fsrc, fdst)
                             return dst
@@ -52,7 +52,7 @@
 import _socket
 from _socket import *
 
-import os, sys, io, selectors
+import os, sys, io, selectors, stat
 from enum import IntEnum, IntFlag
 
 try:
@@ -354,9 +354,13 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
             except (AttributeError, io.UnsupportedOperation) as err:
                 raise _GiveupOnSendfile(err)  # not a regular file
             try:
-                fsize = os.fstat(fileno).st_size
+                fstat = os.fstat(fileno)
             except OSError as err:
                 raise _GiveupOnSendfile(err)  # not a regular file
+            if stat.S_ISFIFO(fstat.st_mode):
+                # sendfile() can't read from a pipe, whose size is 0
+                raise _GiveupOnSendfile("file is a pipe")
+            fsize = fstat.st_size
             if not fsize:
                 return 0  # empty file
             # Truncate to 1GiB to avoid OverflowError, see bpo-38319.
@@ -415,6 +419,74 @@ def _sendfile_use_sendfile(self, file, offset=0, count=None):
             raise _GiveupOnSendfile(
                 "os.sendfile() not available on this platform")
 
+    if hasattr(os, 'splice'):
+
+        def _sendfile_use_splice(self, file, offset=0, count=None):
+            self._check_sendfile_params(file, offset, count)
+            sockno = self.fileno()
+            try:
+                fileno = file.fileno()
+                fstat = os.fstat(fileno)
+            except (AttributeError, io.UnsupportedOperation, OSError) as err:
+                raise _GiveupOnSendfile(err)  # not a pipe
+            if not stat.S_ISFIFO(fstat.st_mode) or not os.get_blocking(fileno):
+                raise _GiveupOnSendfile("file is not a blocking pipe")
+            if offset:
+                raise _GiveupOnSendfile("pipes are not seekable")
+            timeout = self.gettimeout()
+            if timeout == 0:
+                raise ValueError("non-blocking sockets are not supported")
+
+            total_sent = 0
+            # Send what the file object already read from the pipe.
+            if hasattr(file, 'peek'):
+                data = file.peek(1)
+                if count:
+                    data = data[:count]
+                if data:
+                    self.sendall(file.read1(len(data)))
+                    total_sent = len(data)
+            if hasattr(selectors, 'PollSelector'):
+                selector = selectors.PollSelector()
+            else:
+                selector = selectors.SelectSelector()
+            selector.register(sockno, selectors.EVENT_WRITE)
+
+            # localize variable access to minimize overhead
+            selector_select = selector.select
+            os_splice = os.splice
+            blocksize = 2 ** 30
+            while True:
+                if timeout and not selector_select(timeout):
+                    raise TimeoutError('timed out')
+                if count:
+                    blocksize = min(count - total_sent, 2 ** 30)
+                    if blocksize <= 0:
+                        break
+                try:
+                    sent = os_splice(fileno, sockno, blocksize)
+                except BlockingIOError:
+                    if not timeout:
+                        # Block until the socket is ready to send some
+                        # data; avoids hogging CPU resources.
+                        selector_select()
+                    continue
+                except OSError as err:
+                    if total_sent == 0:
+                        # splice() may not support this kind of socket:
+                        # fall back on using plain send().
+                        raise _GiveupOnSendfile(err)
+                    raise err from None
+                else:
+                    if sent == 0:
+                        break  # EOF
+                    total_sent += sent
+            return total_sent
+    else:
+        def _sendfile_use_splice(self, file, offset=0, count=None):
+            raise _GiveupOnSendfile(
+                "os.splice() not available on this platform")
+
     def _sendfile_use_send(self, file, offset=0, count=None):
         self._check_sendfile_params(file, offset, count)
         if self.gettimeout() == 0:
@@ -471,6 +543,7 @@ def sendfile(self, file, offset=0, count=None):
         os.sendfile() and return the total number of bytes which
         were sent.
         *file* must be a regular file object opened in binary mode.
+        If *file* is a pipe, os.splice() is used where available.
         If os.sendfile() is not available (e.g. Windows) or file is
         not a regular file socket.send() will be used instead.
         *offset* tells from where to start reading the file.
@@ -484,6 +557,10 @@ def sendfile(self, file, offset=0, count=None):
         """
         try:
             return self._sendfile_use_sendfile(file, offset, count)
+        except _GiveupOnSendfile:
+            pass
+        try:
+            return self._sendfile_use_splice(file, offset, count)
         except _GiveupOnSendfile:
             return self._sendfile_use_send(file, offset, count)
 
@@ -851,6 +851,32 @@ def test_isidentifier(self):
         # CRASHES isidentifier([])
         # CRASHES isidentifier(NULL)
 
+    @support.cpython_only
+    @unittest.skipIf(_testcapi is None, 'need _testcapi module')
+    def test_intern(self):
+        """Test PyUnicode_InternInPlace() and PyUnicode_InternFromString()"""
+        from _testcapi import unicode_interninplace as interninplace
+        from _testcapi import unicode_internfromstring as internfromstring
+
+        # A string interned by sys.intern() stays mortal, but interning an
+        # equal string through the C API makes it immortal.
+        s = sys.intern(''.join(['capi ', 'interninplace']))
+        t = interninplace(''.join(['capi ', 'interninplace']))
+        self.assertIs(t, s)
+        self.assertGreater(sys.getrefcount(s), 2 ** 15)
+
+        s = sys.intern(''.join(['capi ', 'internfromstring']))
+        t = internfromstring(b'capi internfromstring')
+        self.assertIs(t, s)
+        self.assertGreater(sys.getrefcount(s), 2 ** 15)
+
+        s = interninplace(''.join(['capi ', 'interninplace new']))
+        self.assertIs(sys.intern(''.join(['capi ', 'interninplace new'])), s)
+        self.assertGreater(sys.getrefcount(s), 2 ** 15)
+
+        self.assertRaises(TypeError, interninplace, b'abc')
+        self.assertRaises(TypeError, internfromstring, 'abc')
+
     @support.cpython_only
     @unittest.skipIf(_testcapi is None, 'need _testcapi module')
     def test_copycharacters(self):
@@ -390,6 +390,43 @@ def test_read_bigfield(self):
         finally:
             csv.field_size_limit(limit)
 
+    def test_read_bigfield_split(self):
+        # Fields spanning several lines, or mixing quoted and unquoted parts,
+        # are subject to the field size limit as a whole.
+        limit = csv.field_size_limit()
+        try:
+            csv.field_size_limit(10)
+            self._read_test(['"abcd\n', 'fghij",x'], [['abcd\nfghij', 'x']])
+            self.assertRaises(csv.Error, self._read_test,
+                              ['"abcd\n', 'fghijk",x'], [])
+            self._read_test(['"abcde"fghij,x'], [['abcdefghij', 'x']])
+            self.assertRaises(csv.Error, self._read_test,
+                              ['"abcde"fghijk,x'], [])
+            self.assertRaises(csv.Error, self._read_test,
+                              ['abcde^fghijk,x'], [], escapechar='^')
+            self._read_test(['abcde^fghij,x'], [['abcdefghij', 'x']],
+                            escapechar='^')
+        finally:
+            csv.field_size_limit(limit)
+
+    def test_read_usecols(self):
+        lines = ['a,b,c,d', '1,"2,x",3', '', '"e\nf",g', 'h']
+        self._read_test(lines, [['a', 'b', 'c', 'd'], ['1', '2,x', '3'], [],
+                                ['e\nf', 'g'], ['h']], usecols=None)
+        self._read_test(lines, [['a', 'c'], ['1', '3'], [], ['e\nf'], ['h']],
+                        usecols=[2, 0])
+        self._read_test(lines, [['b', 'd'], ['2,x'], [], ['g'], []],
+                        usecols=range(1, 10, 2))
+        self._read_test(lines, [[], [], [], [], []], usecols=())
+        self._read_test(lines, [['a', 'c'], ['1', '3'], [], ['e\nf'], ['h']],
+                        usecols=[0, 2], delimiter=',')
+        self._read_test(['1,x,2', '3,"y",4'], [[1.0, 2.0], [3.0, 4.0]],
+                        usecols=[0, 2], quoting=csv.QUOTE_NONNUMERIC)
+        self.assertRaises(TypeError, csv.reader, [], usecols=1)
+        self.assertRaises(TypeError, csv.reader, [], usecols=['1'])
+        self.assertRaises(ValueError, csv.reader, [], usecols=[-1])
+        self.assertRaises(TypeError, csv.reader, [], usecols=[0], spam=1)
+
     def test_read_linenum(self):
         r = csv.reader(['line,1', 'line,2', 'line,3'])
         self.assertEqual(r.line_num, 0)
@@ -1138,6 +1138,16 @@ def test_binary_specialize(self):
         got = self.get_disassembly(co_unicode, adaptive=True)
         self.do_disassembly_compare(got, binary_op_quicken % "BINARY_OP_ADD_UNICODE     0 (+)", True)
 
+        co_floordiv = compile('a // b', "<floordiv>", "eval")
+        self.code_quicken(lambda: exec(co_floordiv, {}, {'a': 7, 'b': 2}))
+        got = self.get_disassembly(co_floordiv, adaptive=True)
+        self.do_disassembly_compare(got, binary_op_quicken % "BINARY_OP_FLOOR_DIVIDE_INT     2 (//)", True)
+
+        co_mixed = compile('a * b', "<mixed>", "eval")
+        self.code_quicken(lambda: exec(co_mixed, {}, {'a': 2, 'b': 1.5}))
+        got = self.get_disassembly(co_mixed, adaptive=True)
+        self.do_disassembly_compare(got, binary_op_quicken % "BINARY_OP_MULTIPLY_FLOAT_INT     5 (*)", True)
+
         binary_subscr_quicken = """\
   0           0 RESUME                   0
 
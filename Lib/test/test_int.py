@@ -1,3 +1,4 @@
+import random
 import sys
 import time
 
@@ -851,6 +852,23 @@ def test_pylong_int_divmod(self):
         a, b = divmod(n*3 + 1, n)
         assert a == 3 and b == 1
 
+    @unittest.skipUnless(_pylong, "_pylong module required")
+    def test_pylong_int_mul(self):
+        n = (1 << 100_000) - 1
+        self.assertEqual(n * n, (1 << 200_000) - (1 << 100_001) + 1)
+        self.assertEqual(n * -n, -(n * n))
+        self.assertEqual(-n * (n + 2), -((1 << 200_000) - 1))
+        # Compare against schoolbook multiplication of the limbs, with
+        # operand sizes on both sides of the Toom-3 recursion limits.
+        rng = random.Random(1234)
+        for bits in (60_000, 70_001, 150_000, 200_000):
+            a = rng.getrandbits(bits)
+            b = rng.getrandbits(bits * 3 // 2) | 1
+            expected = sum((a * ((b >> s) & 0xffffffff)) << s
+                           for s in range(0, b.bit_length(), 32))
+            self.assertEqual(a * b, expected)
+            self.assertEqual(_pylong.int_mul(a, -b), -expected)
+
     def test_pylong_str_to_int(self):
         v1 = 1 << 100_000
         s = str(v1)
@@ -883,6 +901,19 @@ def test_pylong_misbehavior_error_path_to_str(
             with self.assertRaises(RuntimeError):
                 str(big_value)
 
+    @support.cpython_only  # tests implementation details of CPython.
+    @unittest.skipUnless(_pylong, "_pylong module required")
+    @mock.patch.object(_pylong, "int_mul")
+    def test_pylong_misbehavior_error_path_mul(self, mock_int_mul):
+        big_value = 1 << 100_000
+        mock_int_mul.return_value = 'not an int'
+        with self.assertRaises(TypeError) as ctx:
+            big_value * big_value
+        self.assertIn('_pylong.int_mul did not', str(ctx.exception))
+        mock_int_mul.side_effect = RuntimeError("test456")
+        with self.assertRaises(RuntimeError):
+            big_value * big_value
+
     @support.cpython_only  # tests implementation details of CPython.
     @unittest.skipUnless(_pylong, "_pylong module required")
     @mock.patch.object(_pylong, "int_from_string")
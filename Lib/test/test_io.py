@@ -1589,6 +1589,46 @@ def f():
         finally:
             os_helper.unlink(os_helper.TESTFN)
 
+    def test_file_read_sizes(self):
+        # Reads of all sizes on a real file, which the C implementation
+        # serves with readv() into the caller's buffer and its own.
+        data = b''.join(b'%d' % i + b'x' * (i % 37) + b'\n' for i in range(300))
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        with self.open(os_helper.TESTFN, "wb") as f:
+            f.write(data)
+        sizes = [1, 15, 16, 17, 33, 100, 5, 48, 2]
+        with self.open(os_helper.TESTFN, self.read_mode, buffering=0) as raw:
+            bufio = self.tp(raw, 16)
+            pos = 0
+            for i, n in enumerate(sizes * 6):
+                kind = i % 4
+                if kind == 0:
+                    got = bufio.read(n)
+                elif kind == 1:
+                    b = bytearray(n)
+                    got = b[:bufio.readinto(b)]
+                elif kind == 2:
+                    b = bytearray(n)
+                    got = b[:bufio.readinto1(b)]
+                    self.assertEqual(got, data[pos:pos + len(got)])
+                    pos += len(got)
+                    self.assertEqual(bufio.tell(), pos)
+                    continue
+                else:
+                    got = bufio.readline()
+                    n = data.index(b'\n', pos) + 1 - pos
+                self.assertEqual(got, data[pos:pos + n])
+                pos += n
+                self.assertEqual(bufio.tell(), pos)
+                self.assertEqual(bufio.peek(1)[:1], data[pos:pos + 1])
+            bufio.seek(pos - 7)
+            self.assertEqual(bufio.read(50), data[pos - 7:pos + 43])
+            bufio.seek(len(data) - 30)
+            self.assertEqual(bufio.read(100), data[-30:])
+            self.assertEqual(bufio.read(100), b'')
+            bufio.seek(3)
+            self.assertEqual(bufio.read(), data[3:])
+
     def test_unseekable(self):
         bufio = self.tp(self.MockUnseekableIO(b"A" * 10))
         self.assertRaises(self.UnsupportedOperation, bufio.tell)
@@ -3260,6 +3300,36 @@ def test_read_by_chunk(self):
             reads += c
         self.assertEqual(reads, "A"*127+"\nB")
 
+    def test_read_split_multibyte(self):
+        # Multibyte sequences and "\r\n" straddling chunk boundaries, with
+        # tell() and seek() in between.
+        text = "h\xe9€\U0001f40d\r\nx\xff\n" * 50
+        for encoding, errors in [("utf-8", "strict"), ("latin-1", "strict"),
+                                 ("ascii", "replace"), ("utf-8", "replace")]:
+            with self.subTest(encoding=encoding, errors=errors):
+                data = text.encode("utf-8")
+                expected = data.decode(encoding, errors).splitlines(True)
+                expected = [line.replace("\r\n", "\n") for line in expected]
+                for chunk_size in (1, 3, 7, 128):
+                    txt = self.TextIOWrapper(self.BytesIO(data),
+                                             encoding=encoding, errors=errors)
+                    txt._CHUNK_SIZE = chunk_size
+                    self.assertEqual(list(txt), expected)
+                    txt.seek(0)
+                    lines = []
+                    positions = []
+                    while line := txt.readline():
+                        lines.append(line)
+                        positions.append(txt.tell())
+                    self.assertEqual(lines, expected)
+                    txt.seek(positions[10])
+                    self.assertEqual(txt.readline(), expected[11])
+                    txt.seek(0)
+                    self.assertEqual(txt.read(), "".join(expected))
+
+        txt = self.TextIOWrapper(self.BytesIO(b"ab\xe9\n"), encoding="ascii")
+        self.assertRaises(UnicodeDecodeError, txt.readline)
+
     def test_writelines(self):
         l = ['ab', 'cd', 'ef']
         buf = self.BytesIO()
@@ -3910,6 +3980,22 @@ def write(self, data):
         t.write("x"*chunk_size)
         self.assertEqual([b"abcdef", b"ghi", b"x"*chunk_size], buf._write_stack)
 
+    def test_write_cached_utf8(self):
+        # Strings which already carry a cached UTF-8 representation are
+        # buffered without being encoded again.
+        _testcapi = import_helper.import_module('_testcapi')
+        buf = self.MockRawIO()
+        t = self.TextIOWrapper(buf, encoding="utf-8", newline="\n")
+        chunk_size = t._CHUNK_SIZE
+        texts = ["h\xe9llo ", "abc", "w€rld\n", "\U0001f40d",
+                 "\xe9" * chunk_size]
+        for text in texts:
+            _testcapi.unicode_asutf8(text)
+            t.write(text)
+        t.flush()
+        self.assertEqual(b"".join(buf._write_stack),
+                         "".join(texts).encode("utf-8"))
+
 
 class PyTextIOWrapperTest(TextIOWrapperTest):
     io = pyio
@@ -0,0 +1,239 @@
+"""
+Tests for the io_uring wrapper.
+"""
+import errno
+import gc
+import os
+import select
+import unittest
+import weakref
+from test.support import os_helper
+
+if not hasattr(select, "io_uring"):
+    raise unittest.SkipTest("test works only on Linux 5.6+")
+
+try:
+    select.io_uring().close()
+except OSError as e:
+    if e.errno in (errno.ENOSYS, errno.EPERM, errno.EACCES):
+        raise unittest.SkipTest("io_uring is not available")
+    raise
+
+
+class TestIoUring(unittest.TestCase):
+
+    def setUp(self):
+        self.data = bytes(range(256)) * 64
+        with open(os_helper.TESTFN, "wb") as f:
+            f.write(self.data)
+        self.fd = os.open(os_helper.TESTFN, os.O_RDWR)
+
+    def tearDown(self):
+        os.close(self.fd)
+        os_helper.unlink(os_helper.TESTFN)
+
+    def test_create(self):
+        ring = select.io_uring(16)
+        self.assertGreater(ring.fileno(), 0)
+        self.assertFalse(ring.closed)
+        self.assertFalse(os.get_inheritable(ring.fileno()))
+        ring.close()
+        self.assertTrue(ring.closed)
+        self.assertRaises(ValueError, ring.fileno)
+        self.assertRaises(ValueError, ring.submit)
+        self.assertRaises(ValueError, ring.completions)
+        ring.close()
+
+        self.assertRaises(ValueError, select.io_uring, 0)
+        self.assertRaises(TypeError, select.io_uring, 1.5)
+
+    def test_context_manager(self):
+        with select.io_uring() as ring:
+            self.assertFalse(ring.closed)
+        self.assertTrue(ring.closed)
+        with self.assertRaises(ValueError):
+            with ring:
+                pass
+
+    def test_read_batch(self):
+        with select.io_uring(8) as ring:
+            buffers = [bytearray(100) for i in range(16)]
+            for i, buf in enumerate(buffers):
+                ring.read(self.fd, buf, i * 300, user_data=i)
+            # The submission ring holds 8 entries: queueing more submitted
+            # the first ones already.
+            self.assertEqual(ring.submit(wait=16), 8)
+            self.assertEqual(sorted(ring.completions()),
+                             [(i, 100) for i in range(16)])
+            self.assertEqual(ring.completions(), [])
+            for i, buf in enumerate(buffers):
+                self.assertEqual(buf, self.data[i * 300:i * 300 + 100])
+
+            # At most twice as many operations in flight as entries
+            for i in range(16):
+                ring.read(self.fd, bytearray(1), 0)
+            with self.assertRaises(OSError) as cm:
+                ring.read(self.fd, bytearray(1), 0)
+            self.assertEqual(cm.exception.errno, errno.EBUSY)
+            ring.submit(wait=16)
+            self.assertEqual(len(ring.completions()), 16)
+
+    def test_read_current_position(self):
+        os.lseek(self.fd, 10, os.SEEK_SET)
+        buf = bytearray(5)
+        with select.io_uring() as ring:
+            ring.read(self.fd, buf, user_data=1)
+            ring.submit(wait=1)
+            self.assertEqual(ring.completions(), [(1, 5)])
+        self.assertEqual(buf, self.data[10:15])
+        self.assertEqual(os.lseek(self.fd, 0, os.SEEK_CUR), 15)
+
+    def test_write(self):
+        with select.io_uring() as ring:
+            ring.write(self.fd, b"abc", 1, user_data=1,
+                       flags=select.IOSQE_IO_LINK)
+            ring.write(self.fd, memoryview(b"xyz")[1:], 100, user_data=2)
+            ring.submit(wait=2)
+            self.assertEqual(sorted(ring.completions()), [(1, 3), (2, 2)])
+        self.assertEqual(os.pread(self.fd, 4, 0), b"\x00abc")
+        self.assertEqual(os.pread(self.fd, 3, 100), b"yzf")
+
+    def test_errors(self):
+        with select.io_uring() as ring:
+            self.assertRaises(TypeError, ring.read, self.fd, b"abc")
+            self.assertRaises(TypeError, ring.write, self.fd, "abc")
+            self.assertRaises(ValueError, ring.read, self.fd, bytearray(1), -2)
+            self.assertRaises(ValueError, ring.read, self.fd, bytearray(1),
+                              flags=1 << 7)
+            self.assertRaises(ValueError, ring.submit, 1)
+            r, w = os.pipe()
+            os.close(w)
+            ring.read(r, bytearray(1), user_data=5)
+            ring.write(r, b"x", user_data=6)
+            ring.submit(wait=2)
+            self.assertEqual(sorted(ring.completions()),
+                             [(5, 0), (6, -errno.EBADF)])
+            os.close(r)
+
+    def test_buffer_exported(self):
+        r, w = os.pipe()
+        self.addCleanup(os.close, r)
+        self.addCleanup(os.close, w)
+        buf = bytearray(10)
+        with select.io_uring() as ring:
+            ring.read(r, buf, user_data=1)
+            ring.submit()
+            # The kernel writes into the buffer once data arrives
+            self.assertRaises(BufferError, buf.extend, b"x" * 100)
+            os.write(w, b"abc")
+            ring.submit(wait=1)
+            self.assertEqual(ring.completions(), [(1, 3)])
+            buf.extend(b"x" * 100)
+        self.assertEqual(buf[:3], b"abc")
+
+    def test_close_cancels(self):
+        r, w = os.pipe()
+        self.addCleanup(os.close, r)
+        self.addCleanup(os.close, w)
+        buf = bytearray(10)
+        ring = select.io_uring()
+        ring.read(r, buf)
+        ring.submit()
+        # close() doesn't hang on the read which never completes, and the
+        # buffer is released once the read is cancelled.
+        ring.close()
+        buf.extend(b"x" * 100)
+        os.write(w, b"abc")
+        self.assertEqual(buf, bytes(10) + b"x" * 100)
+
+    def test_cycle(self):
+        # The ring keeps the buffers of its operations alive, and a buffer
+        # can refer back to the ring: the garbage collector breaks such
+        # cycles by closing the ring.
+        class Buffer(bytearray):
+            pass
+        r, w = os.pipe()
+        self.addCleanup(os.close, r)
+        self.addCleanup(os.close, w)
+        ring = select.io_uring()
+        buf = Buffer(10)
+        buf.ring = ring
+        ring.read(r, buf)
+        ring.submit()
+        buf_ref = weakref.ref(buf)
+        del ring, buf
+        gc.collect()
+        self.assertIsNone(buf_ref())
+
+        buf = Buffer(10)
+        ring = select.io_uring()
+        buf.ring = ring
+        ring.register_buffers([buf])
+        buf_ref = weakref.ref(buf)
+        del ring, buf
+        gc.collect()
+        self.assertIsNone(buf_ref())
+
+    def test_fixed_buffers(self):
+        buffers = [bytearray(10), bytearray(20)]
+        with select.io_uring() as ring:
+            self.assertRaises(ValueError, ring.read_fixed, self.fd, 0)
+            ring.register_buffers(buffers)
+            with self.assertRaises(OSError) as cm:
+                ring.register_buffers(buffers)
+            self.assertEqual(cm.exception.errno, errno.EBUSY)
+            self.assertRaises(BufferError, buffers[0].extend, b"x")
+            self.assertRaises(ValueError, ring.read_fixed, self.fd, 2)
+
+            ring.read_fixed(self.fd, 1, 5, user_data=1)
+            with self.assertRaises(OSError) as cm:
+                ring.unregister_buffers()
+            self.assertEqual(cm.exception.errno, errno.EBUSY)
+            ring.submit(wait=1)
+            self.assertEqual(ring.completions(), [(1, 20)])
+            self.assertEqual(buffers[1], self.data[5:25])
+
+            buffers[0][:] = b"0123456789"
+            ring.write_fixed(self.fd, 0, 1000, user_data=2)
+            ring.submit(wait=1)
+            self.assertEqual(ring.completions(), [(2, 10)])
+            self.assertEqual(os.pread(self.fd, 10, 1000), b"0123456789")
+
+            ring.unregister_buffers()
+            buffers[0].extend(b"x")
+            self.assertRaises(OSError, ring.unregister_buffers)
+            self.assertRaises(ValueError, ring.read_fixed, self.fd, 0)
+
+            ring.register_buffers(buffers[1:])
+        buffers[1].extend(b"x")
+
+    def test_eventfd(self):
+        efd = os.eventfd(0, os.EFD_NONBLOCK)
+        self.addCleanup(os.close, efd)
+        with select.io_uring() as ring:
+            ring.register_eventfd(efd)
+            ring.read(self.fd, bytearray(1))
+            ring.read(self.fd, bytearray(1))
+            ring.submit(wait=2)
+            self.assertGreater(os.eventfd_read(efd), 0)
+            self.assertEqual(len(ring.completions()), 2)
+
+            ring.unregister_eventfd()
+            ring.read(self.fd, bytearray(1))
+            ring.submit(wait=1)
+            self.assertRaises(BlockingIOError, os.eventfd_read, efd)
+
+    def test_poll_fileno(self):
+        with select.io_uring() as ring:
+            ep = select.poll()
+            ep.register(ring.fileno(), select.POLLIN)
+            self.assertEqual(ep.poll(0), [])
+            ring.read(self.fd, bytearray(1))
+            ring.submit(wait=1)
+            self.assertEqual(ep.poll(0), [(ring.fileno(), select.POLLIN)])
+            ring.completions()
+            self.assertEqual(ep.poll(0), [])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -57,6 +57,21 @@ def __lt__(self, o):
         d[1337] = "true.dat"
         self.assertEqual(self.dumps(d, sort_keys=True), '{"1337": "true.dat"}')
 
+    def test_encode_repeated_keys(self):
+        class S(str):
+            pass
+        records = [{'id': i, 'name': 'x\u20ac', 'tags': {'id': -i}}
+                   for i in range(3)]
+        records.append({S('id'): 9, 'id\n': 10})
+        self.assertEqual(self.dumps(records, separators=(',', ':')),
+                         '[{"id":0,"name":"x\\u20ac","tags":{"id":0}},'
+                         '{"id":1,"name":"x\\u20ac","tags":{"id":-1}},'
+                         '{"id":2,"name":"x\\u20ac","tags":{"id":-2}},'
+                         '{"id":9,"id\\n":10}]')
+        # More distinct keys than the encoder remembers
+        d = {str(i): i for i in range(3000)}
+        self.assertEqual(self.json.loads(self.dumps([d, d])), [d, d])
+
 
 class TestPyDump(TestDump, PyTest): pass
 
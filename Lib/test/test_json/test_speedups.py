@@ -22,6 +22,16 @@ class TestDecode(CTest):
     def test_make_scanner(self):
         self.assertRaises(AttributeError, self.json.scanner.c_make_scanner, 1)
 
+    def test_scanner_bytes(self):
+        # The scanner accepts UTF-8 bytes and returns byte offsets
+        decoder = self.json.decoder.JSONDecoder()
+        scanner = self.json.scanner.c_make_scanner(decoder)
+        self.assertEqual(scanner(b' ["\xc3\xa9", 1] ', 1), (['\xe9', 1], 10))
+        self.assertRaises(TypeError, scanner, bytearray(b'1'), 0)
+        with self.assertRaises(StopIteration) as cm:
+            scanner(b'\xc3\xa9 x', 3)
+        self.assertEqual(cm.exception.value, 3)
+
     def test_bad_bool_args(self):
         def test(value):
             self.json.decoder.JSONDecoder(strict=BadBool()).decode(value)
@@ -0,0 +1,151 @@
+from io import StringIO, BytesIO
+from test.test_json import PyTest, CTest
+
+
+class TestStream:
+    def feed(self, data, items=False, size=1, **kw):
+        decoder = self.json.JSONStreamDecoder(self.json.JSONDecoder(**kw),
+                                              items=items)
+        values = []
+        for i in range(0, len(data), size):
+            values += decoder.feed(data[i:i + size])
+        return values + decoder.close()
+
+    def test_documents(self):
+        docs = ['{"a": [1, 2.5, "x\\"]}"], "b": {}}', '[]', '"abc\\\\"', '12',
+                'true', 'null', '[{"}": "["}]', '-1e5']
+        for sep in '\n', '\r\n', ' ', '\n\n  ':
+            text = sep.join(docs) + sep
+            expected = [self.loads(doc) for doc in docs]
+            for size in 1, 2, 7, len(text):
+                with self.subTest(sep=sep, size=size):
+                    self.assertEqual(self.feed(text, size=size), expected)
+                    self.assertEqual(self.feed(text.encode(), size=size),
+                                     expected)
+        self.assertEqual(self.feed('{"a":1}{"b":2}[3]"4"'),
+                         [{'a': 1}, {'b': 2}, [3], '4'])
+        self.assertEqual(self.feed(''), [])
+        self.assertEqual(self.feed(' \n '), [])
+
+    def test_values_returned_early(self):
+        decoder = self.json.JSONStreamDecoder()
+        self.assertEqual(decoder.feed('{"a": 1'), [])
+        self.assertEqual(decoder.feed('}\n[2]\n'), [{'a': 1}, [2]])
+        # A number might continue in the next chunk
+        self.assertEqual(decoder.feed('12'), [])
+        self.assertEqual(decoder.feed('3 4'), [123])
+        self.assertEqual(decoder.close(), [4])
+
+    def test_items(self):
+        text = '[1, "a,]", {"b": [2, {}]}, [], null]'
+        expected = self.loads(text)
+        for size in 1, 3, len(text):
+            with self.subTest(size=size):
+                self.assertEqual(self.feed(text, items=True, size=size),
+                                 expected)
+        self.assertEqual(self.feed(' [ ] ', items=True), [])
+        self.assertEqual(self.feed('[\n1\n,\n2\n]\n', items=True), [1, 2])
+        decoder = self.json.JSONStreamDecoder(items=True)
+        self.assertEqual(decoder.feed('[{"a": 1}, [2'), [{'a': 1}])
+        self.assertEqual(decoder.feed(']]'), [[2]])
+        self.assertEqual(decoder.close(), [])
+
+    def test_decoder_options(self):
+        self.assertEqual(self.feed('{"a": 1.5}\n2.5', parse_float=str,
+                                   object_pairs_hook=list),
+                         [[('a', '1.5')], '2.5'])
+        self.assertEqual(self.feed('[1, 2]', items=True, parse_int=float),
+                         [1.0, 2.0])
+
+    def test_hooks_called_once(self):
+        # Hooks only see complete values, and each value exactly once
+        calls = []
+        def hook(obj):
+            calls.append(obj)
+            return obj
+        for items in False, True:
+            with self.subTest(items=items):
+                decoder = self.json.JSONStreamDecoder(
+                    self.json.JSONDecoder(object_hook=hook), items=items)
+                self.assertEqual(decoder.feed('[{"a":1}, {"b":'), [{'a': 1}]
+                                 if items else [])
+                self.assertEqual(decoder.feed('2}]\n' if items else '2}]'),
+                                 [{'b': 2}] if items
+                                 else [[{'a': 1}, {'b': 2}]])
+                self.assertEqual(decoder.close(), [])
+                self.assertEqual(calls, [{'a': 1}, {'b': 2}])
+                calls.clear()
+        self.assertEqual(self.feed('[1.5, 2]\n[3, 4.5]', size=5,
+                                   parse_float=hook, parse_int=hook),
+                         [['1.5', '2'], ['3', '4.5']])
+        self.assertEqual(calls, ['1.5', '2', '3', '4.5'])
+
+    def test_encodings(self):
+        docs = ['"€"', '{"\U0001f600": 1}']
+        text = '\n'.join(docs)
+        expected = [self.loads(doc) for doc in docs]
+        for encoding in 'utf-8', 'utf-8-sig', 'utf-16', 'utf-16-be', 'utf-32':
+            with self.subTest(encoding=encoding):
+                self.assertEqual(self.feed(text.encode(encoding)), expected)
+        self.assertEqual(self.feed(b'1'), [1])
+        decoder = self.json.JSONStreamDecoder()
+        decoder.feed(b'1 ')
+        self.assertRaises(TypeError, decoder.feed, '2')
+        decoder = self.json.JSONStreamDecoder()
+        decoder.feed('1 ')
+        self.assertRaises(TypeError, decoder.feed, b'2')
+        self.assertRaises(TypeError, decoder.feed, 2)
+
+    def test_errors(self):
+        for text, items in [('[1, 2', False), ('[1, 2', True), ('{"a"', False),
+                            ('"abc', False), ('[1, 2,]', True), ('[1 2]', True),
+                            ('[1, }', True), ('[1}', True), ('[1] 2', True),
+                            ('[', True), ('', True), ('1x', False),
+                            ('[[1]', True), ('nul', False)]:
+            with self.subTest(text=text, items=items):
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    self.loads(text)
+                expected = cm.exception
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    self.feed(text, items=items)
+                self.assertEqual(cm.exception.msg, expected.msg)
+                self.assertEqual(cm.exception.pos, expected.pos)
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            self.feed(' {"a": 1}', items=True)
+        self.assertEqual(cm.exception.msg, "Expecting '['")
+        self.assertEqual(cm.exception.pos, 1)
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            self.feed('[1]]')
+        self.assertEqual(cm.exception.msg, "Expecting value")
+        self.assertEqual(cm.exception.pos, 3)
+
+    def test_error_position(self):
+        decoder = self.json.JSONStreamDecoder()
+        self.assertEqual(decoder.feed('1\n[2,\n3]\n  {"a": '), [1, [2, 3]])
+        with self.assertRaises(self.JSONDecodeError) as cm:
+            decoder.feed('}')
+        self.assertEqual(cm.exception.msg, 'Expecting value')
+        self.assertEqual(cm.exception.pos, 17)
+        self.assertEqual(cm.exception.lineno, 4)
+        self.assertEqual(cm.exception.colno, 9)
+        self.assertIn('line 4 column 9 (char 17)', str(cm.exception))
+
+    def test_iterload(self):
+        text = '{"a": 1}\n[2, 3]\n"4"\n'
+        self.assertEqual(list(self.json.iterload(StringIO(text))),
+                         [{'a': 1}, [2, 3], '4'])
+        self.assertEqual(list(self.json.iterload(BytesIO(text.encode()))),
+                         [{'a': 1}, [2, 3], '4'])
+        it = self.json.iterload(StringIO('[1.5, {"b": 2}]'), items=True,
+                                parse_float=str, object_hook=dict.items)
+        self.assertEqual(next(it), '1.5')
+        self.assertEqual(list(next(it)), [('b', 2)])
+        self.assertRaises(StopIteration, next, it)
+        it = self.json.iterload(StringIO('1 2 ['))
+        self.assertEqual(next(it), 1)
+        self.assertEqual(next(it), 2)
+        self.assertRaises(self.JSONDecodeError, next, it)
+
+
+class TestPyStream(TestStream, PyTest): pass
+class TestCStream(TestStream, CTest): pass
@@ -79,6 +79,45 @@ def test_bytes_decode(self):
         self.assertEqual(self.loads(b'\x007'), 7)
         self.assertEqual(self.loads(b'57'), 57)
 
+    def test_utf8_bytes_decode(self):
+        # UTF-8 is parsed without being decoded first: check that strings,
+        # including long ones and ones with escapes, and errors are the
+        # same as for str.
+        for data in ["", "abc", "x" * 100, "a\xb5" * 50, "\u20ac" * 20,
+                     "\U0001d120", "a\"b\\c\n" * 10, "\udc80",
+                     {"\xb5": [1.5, None, "\u20ac" * 9, {"k": True}]}]:
+            for ensure_ascii in True, False:
+                s = self.dumps(data, ensure_ascii=ensure_ascii)
+                with self.subTest(s=s):
+                    b = s.encode('utf-8', 'surrogatepass')
+                    self.assertEqual(self.loads(b), data)
+                    self.assertEqual(self.loads(b' \n' + b + b'\r\t'), data)
+                    self.assertEqual(self.loads(b, object_pairs_hook=list),
+                                     self.loads(s, object_pairs_hook=list))
+        self.assertEqual(self.loads(b'"\xed\xb2\x80"'), '\udc80')
+        self.assertEqual(self.loads(b'["\x1f"]', strict=False), ['\x1f'])
+        for b in [b'["\xc3\xa9\xc3\xa9", 1,, 2]', b'{"\xe2\x82\xac": 1',
+                  b'"\xc3\xa9\n\xc3\xa9', b'["\x1f"]', b'\xc3\xa9',
+                  b'["\xc3\xa9" 1]', b'[1] \xc3\xa9', b'', b'"\\x"']:
+            with self.subTest(b=b):
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    self.loads(b.decode())
+                expected = cm.exception
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    self.loads(b)
+                self.assertEqual(cm.exception.msg, expected.msg)
+                self.assertEqual(cm.exception.pos, expected.pos)
+                self.assertEqual(cm.exception.doc, expected.doc)
+        for b in [b'["\xc3"]', b'["\xc3\xa9\xff" 1]', b'["a", 1,\x80]',
+                  b'[1] \xff', b'{"\\n\xe9": 1}']:
+            with self.subTest(b=b):
+                with self.assertRaises(UnicodeDecodeError) as cm:
+                    b.decode()
+                expected = cm.exception
+                with self.assertRaises(UnicodeDecodeError) as cm:
+                    self.loads(b)
+                self.assertEqual(cm.exception.start, expected.start)
+
     def test_object_pairs_hook_with_unicode(self):
         s = '{"xkd":1, "kcw":2, "art":3, "hxm":4, "qrt":5, "pad":6, "hoy":7}'
         p = [("xkd", 1), ("kcw", 2), ("art", 3), ("hxm", 4),
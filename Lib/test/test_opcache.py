@@ -452,6 +452,46 @@ def f():
             self.assertFalse(f())
 
 
+class TestBinaryOpCache(unittest.TestCase):
+    def test_int_operands_after_optimization(self):
+        def f(a, b):
+            return a // b, a % b, a & b, a << b
+
+        for _ in range(1025):
+            self.assertEqual(f(7, 2), (3, 1, 2, 28))
+
+        self.assertEqual(f(-7, 2), (-4, 1, 0, -28))
+        self.assertEqual(f(1 << 100, 3),
+                         ((1 << 100) // 3, 1, 0, 1 << 103))
+        self.assertEqual(f(True, 2), (0, 1, 0, 4))
+        with self.assertRaises(ZeroDivisionError):
+            f(7, 0)
+        with self.assertRaises(ValueError):
+            f(7, -1)
+
+    def test_float_operands_after_optimization(self):
+        def f(a, b):
+            return a * b, b * a
+
+        def g(a, b):
+            return a / b
+
+        for _ in range(1025):
+            self.assertEqual(f(1.5, 2), (3.0, 3.0))
+            self.assertEqual(g(3.0, 2.0), 1.5)
+
+        self.assertEqual(f(1.5, 1 << 100), (1.5 * 2.0**100,) * 2)
+        self.assertEqual(f(1.5, 2.0), (3.0, 3.0))
+        self.assertEqual(f(1.5, True), (1.5, 1.5))
+        self.assertEqual(str(f(-0.0, 3)), '(-0.0, -0.0)')
+        self.assertEqual(g(3.0, 2), 1.5)
+        self.assertEqual(g(3, 2.0), 1.5)
+        with self.assertRaises(ZeroDivisionError):
+            g(1.5, 0.0)
+        with self.assertRaises(ZeroDivisionError):
+            g(1.5, -0.0)
+
+
 if __name__ == "__main__":
     import unittest
     unittest.main()
@@ -2,10 +2,12 @@
                           cpython_only, captured_stdout,
                           check_disallow_instantiation, is_emscripten, is_wasi,
                           SHORT_TIMEOUT)
+from test.support import threading_helper
 import locale
 import re
 import string
 import sys
+import threading
 import time
 import unittest
 import warnings
@@ -707,6 +709,99 @@ def test_repeat_minmax(self):
         self.checkPatternError(r'x{2,1}',
                                'min repeat greater than max repeat', 2)
 
+    def test_min_repeat_one_literal_tail(self):
+        # Lazy single-character repeats followed by a literal skip ahead to
+        # the next occurrence of the literal.
+        for s in ('ab', 'a\xe9', 'a\u20ac', 'a\U0001f600'):
+            a, b = s
+            text = f'{a}{a}{b}{a}{b}'
+            self.assertEqual(re.match(f'(.*?){b}', text).group(1), f'{a}{a}')
+            self.assertEqual(re.match(f'(.*?){b}{a}', text).group(1), f'{a}{a}')
+            self.assertEqual(re.match(f'(.+?){b}$', text).group(1),
+                             f'{a}{a}{b}{a}')
+            self.assertEqual(re.match(f'(.{{3,}}?){b}', text).group(1),
+                             f'{a}{a}{b}{a}')
+            self.assertIsNone(re.match(f'(.{{0,1}}?){b}', text))
+            self.assertIsNone(re.match(f'(.*?){b}', f'{a}\n{b}'))
+            self.assertEqual(re.match(f'(?s)(.*?){b}', f'{a}\n{b}').group(1),
+                             f'{a}\n')
+            self.assertEqual(re.match(f'([{a}]*?){b}', text).group(1),
+                             f'{a}{a}')
+            self.assertIsNone(re.match(f'([{a}]*?){b}{b}', text))
+            self.assertIsNone(re.match(f'(.*?){b}', a * 10))
+        self.assertEqual(re.match(rb'(.*?)b', b'aab').group(1), b'aa')
+        self.assertIsNone(re.match(rb'(.*?)b', b'aa\nb'))
+        self.assertEqual(re.match(r'(.*?)\u20ac', 'aa\u20ac').group(1), 'aa')
+        self.assertIsNone(re.match(r'(.*?)\u20ac', 'aa'))
+        self.assertEqual(re.findall(r'"(.*?)"', 'a "b" c "" "d"'), ['b', '', 'd'])
+        self.assertEqual(re.match(r'.*', 'ab\ncd').group(), 'ab')
+        self.assertEqual(re.match(r'[^c]*', 'ab\ncd').group(), 'ab\n')
+
+    def test_search_required_literal(self):
+        # Searches give up early when the subject lacks a literal that
+        # every match must contain.
+        for s in ('ab', 'a\xe9', 'a\u20ac', 'a\U0001f600'):
+            a, b = s
+            p = re.compile(f'\\w*{a}{b}{b}(x?)\\d*')
+            self.assertIsNone(p.search(f'{a}{b}{a}{b}'))
+            self.assertEqual(p.search(f'-{a}{b}{b}1-').span(), (1, 5))
+            self.assertIsNone(p.search(f'-{a}{b}{b}1-', 2))
+            self.assertIsNone(p.search(f'-{a}{b}{b}1-', 0, 3))
+            self.assertEqual(p.findall(f'{a}{b}{b} {a}{b} {a}{b}{b}x'),
+                             ['', 'x'])
+            self.assertEqual(p.sub('-', f'{a}{b}{b}.{a}{b}'), f'-.{a}{b}')
+            self.assertEqual(p.split(f'1{a}{b}{b}2 {a}{b}'),
+                             ['', '', f' {a}{b}'])
+        p = re.compile(rb'\w*(ab)(c)d')
+        self.assertIsNone(p.search(b'xabcxd'))
+        self.assertIsNone(p.search(bytearray(b'xabcxd')))
+        self.assertEqual(p.search(memoryview(b'-xabcd')).span(), (1, 6))
+        self.assertEqual(re.findall(r'.a(?i:b)c', 'xaBc xabc xab'),
+                         ['xaBc', 'xabc'])
+        self.assertEqual(re.findall(r'(?i).a-c', 'xA-C xa-c'),
+                         ['xA-C', 'xa-c'])
+        self.assertEqual(re.findall(r'\d+(?:xy|z)*qq', '1qq 2xyqq 3zz'),
+                         ['1qq', '2xyqq'])
+
+    @threading_helper.requires_working_threading()
+    def test_large_subject_threads(self):
+        # The engine runs without the GIL on large str and bytes subjects.
+        pattern = r'(?:(\w)\1|x)+(?=;)|(\d{2,}?)y'
+        def check(unit):
+            if isinstance(unit, bytes):
+                p = re.compile(pattern.encode())
+            else:
+                p = re.compile(pattern)
+            text = unit * 1000
+            n = len(unit)
+            last = list(p.finditer(unit))[-1]
+            self.assertEqual(p.findall(text), p.findall(unit) * 1000)
+            self.assertEqual([m.span() for m in p.finditer(text)][-2:],
+                             [(s + 999*n, e + 999*n)
+                              for s, e in (m.span() for m in p.finditer(unit))])
+            self.assertEqual(p.search(text, 999*n).start(),
+                             p.search(unit).start() + 999*n)
+            self.assertEqual(p.match(text, 999*n + last.start()).end(),
+                             999*n + last.end())
+            self.assertIsNone(p.fullmatch(text))
+            self.assertEqual(p.sub(unit[:0], text), p.sub(unit[:0], unit) * 1000)
+            self.assertEqual(len(p.split(text)), 6001)
+        units = ['abc-123y;aaxbb;', '\xe9abc-123y;aaxbb;',
+                 '\u20acabc-123y;aaxbb;', b'abc-123y;aaxbb;']
+        errors = []
+        def run(unit):
+            try:
+                check(unit)
+            except Exception as e:
+                errors.append(e)
+        threads = [threading.Thread(target=run, args=(u,)) for u in units]
+        with threading_helper.start_threads(threads):
+            pass
+        if errors:
+            raise errors[0]
+        for unit in units:
+            check(unit)
+
     def test_getattr(self):
         self.assertEqual(re.compile("(?i)(a)(b)").pattern, "(?i)(a)(b)")
         self.assertEqual(re.compile("(?i)(a)(b)").flags, re.I | re.U)
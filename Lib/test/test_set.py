@@ -11,6 +11,7 @@
 import collections
 import collections.abc
 import itertools
+import sys
 
 class PassThru(Exception):
     pass
@@ -160,6 +161,23 @@ def test_difference(self):
             self.assertEqual(self.thetype('abcba').difference(), set('abc'))
             self.assertEqual(self.thetype('abcba').difference(C('a'), C('b')), set('c'))
 
+    def test_difference_large(self):
+        n = 100_000
+        a = self.thetype(range(n))
+        for other in (set(range(n // 2, 2 * n)), dict.fromkeys(range(n // 2, 2 * n))):
+            d = a.difference(other)
+            self.assertEqual(type(d), self.basetype)
+            self.assertEqual(d, set(range(n // 2)))
+        self.assertEqual(a - set(range(-5, 0)), set(range(n)))
+        # The result table is sized for len(a) up front, and shrunk again
+        # when most elements are removed.
+        empty = a - set(range(n))
+        self.assertEqual(empty, set())
+        if support.check_impl_detail():
+            self.assertEqual(sys.getsizeof(empty), sys.getsizeof(set()))
+            small = a - set(range(1, n))
+            self.assertEqual(sys.getsizeof(small), sys.getsizeof({0}))
+
     def test_sub(self):
         i = self.s.difference(self.otherword)
         self.assertEqual(self.s - set(self.otherword), i)
@@ -16,6 +16,7 @@
 import string
 import contextlib
 import io
+import threading
 from shutil import (make_archive,
                     register_archive_format, unregister_archive_format,
                     get_archive_formats, Error, unpack_archive,
@@ -33,6 +34,7 @@
 from test import support
 from test.support import os_helper
 from test.support.os_helper import TESTFN, FakePath
+from test.support import threading_helper
 from test.support import warnings_helper
 
 TESTFN2 = TESTFN + "2"
@@ -2658,6 +2660,63 @@ def test_file_offset(self):
             self.assertEqual(src.tell(), self.FILESIZE)
             self.assertEqual(dst.tell(), self.FILESIZE)
 
+    def test_buffered_data(self):
+        # Data already read into the buffer of src, or not yet flushed
+        # from the buffer of dst, is copied in order.
+        with open(TESTFN, "rb") as f:
+            data = f.read()
+        for opener in open, functools.partial(open, buffering=0):
+            with opener(TESTFN, "rb") as src, opener(TESTFN2, "wb") as dst:
+                self.assertEqual(src.read(10), data[:10])
+                dst.write(b"head")
+                shutil.copyfileobj(src, dst)
+                self.assertEqual(src.tell(), self.FILESIZE)
+                self.assertEqual(dst.tell(), self.FILESIZE - 6)
+                dst.write(b"tail")
+                src.seek(100)
+                self.assertEqual(src.read(5), data[100:105])
+            with open(TESTFN2, "rb") as f:
+                self.assertEqual(f.read(), b"head" + data[10:] + b"tail")
+
+        with open(TESTFN2, "ab") as dst, open(TESTFN, "rb") as src:
+            shutil.copyfileobj(src, dst)
+        with open(TESTFN2, "rb") as f:
+            self.assertEqual(f.read(), b"head" + data[10:] + b"tail" + data)
+
+    @unittest.skipUnless(hasattr(os, "splice"), "needs os.splice()")
+    def test_pipe(self):
+        with open(TESTFN, "rb") as f:
+            data = f.read()
+        r, w = os.pipe()
+        with open(r, "rb") as src, open(w, "wb") as dst:
+            def copy():
+                with open(TESTFN, "rb") as f:
+                    shutil.copyfileobj(f, dst)
+                dst.close()
+            with unittest.mock.patch("os.splice", wraps=os.splice) as m:
+                with threading_helper.start_threads(
+                        [threading.Thread(target=copy)]):
+                    self.assertEqual(src.read(3), data[:3])
+                    with open(TESTFN2, "wb") as f:
+                        shutil.copyfileobj(src, f)
+        assert m.called
+        with open(TESTFN2, "rb") as f:
+            self.assertEqual(f.read(), data[3:])
+
+    @unittest.skipUnless(hasattr(os, "copy_file_range"),
+                         "needs os.copy_file_range()")
+    def test_zerocopy_fallback(self):
+        # copyfileobj() falls back on read() and write() if the zero-copy
+        # call fails.
+        for exc in OSError(errno.EXDEV, "yo"), OSError(errno.ENOSYS, "yo"):
+            with unittest.mock.patch("os.copy_file_range",
+                                     side_effect=exc) as m:
+                with self.get_files() as (src, dst):
+                    shutil.copyfileobj(src, dst)
+                    self.assertEqual(dst.tell(), self.FILESIZE)
+            assert m.called
+            self.assert_files_eq(TESTFN, TESTFN2)
+
     @unittest.skipIf(os.name != 'nt', "Windows only")
     def test_win_impl(self):
         # Make sure alternate Windows implementation is called.
@@ -2793,6 +2852,12 @@ def test_filesystem_full(self):
 class TestZeroCopySendfile(_ZeroCopyFileTest, unittest.TestCase):
     PATCHPOINT = "os.sendfile"
 
+    def setUp(self):
+        # copyfile() tries copy_file_range() first
+        patcher = unittest.mock.patch("shutil._USE_CP_COPY_FILE_RANGE", False)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+
     def zerocopy_fun(self, fsrc, fdst):
         return shutil._fastcopy_sendfile(fsrc, fdst)
 
@@ -2908,6 +2973,42 @@ def test_file2file_not_supported(self):
             shutil._USE_CP_SENDFILE = True
 
 
+@unittest.skipIf(not SUPPORTS_SENDFILE or not hasattr(os, "copy_file_range"),
+                 'os.copy_file_range() not supported')
+class TestZeroCopyCopyFileRange(_ZeroCopyFileTest, unittest.TestCase):
+    PATCHPOINT = "os.copy_file_range"
+
+    def zerocopy_fun(self, fsrc, fdst):
+        return shutil._fastcopy_copy_file_range(fsrc, fdst)
+
+    def test_empty_file(self):
+        # Nothing copied on the first call: the content is checked with
+        # read() instead.
+        srcname = TESTFN + 'src'
+        dstname = TESTFN + 'dst'
+        self.addCleanup(lambda: os_helper.unlink(srcname))
+        self.addCleanup(lambda: os_helper.unlink(dstname))
+        with open(srcname, "wb"):
+            pass
+
+        with open(srcname, "rb") as src:
+            with open(dstname, "wb") as dst:
+                with self.assertRaises(_GiveupOnFastCopy):
+                    self.zerocopy_fun(src, dst)
+        shutil.copyfile(srcname, dstname)
+        self.assertEqual(read_file(dstname, binary=True), b"")
+
+    def test_zero_on_first_call(self):
+        # Some filesystems report 0 bytes to copy: read() and write()
+        # are used instead.
+        with unittest.mock.patch(self.PATCHPOINT, return_value=0):
+            with self.get_files() as (src, dst):
+                with self.assertRaises(_GiveupOnFastCopy):
+                    self.zerocopy_fun(src, dst)
+            shutil.copyfile(TESTFN, TESTFN2)
+        self.assertEqual(read_file(TESTFN2, binary=True), self.FILEDATA)
+
+
 @unittest.skipIf(not MACOS, 'macOS only')
 class TestZeroCopyMACOS(_ZeroCopyFileTest, unittest.TestCase):
     PATCHPOINT = "posix._fcopyfile"
@@ -6287,6 +6287,27 @@ def testOffset(self):
         self.assertEqual(len(data), self.FILESIZE - 5000)
         self.assertEqual(data, self.FILEDATA[5000:])
 
+    # pipe
+
+    PIPESIZE = 16000  # fits in the pipe buffer
+
+    def _testPipe(self):
+        address = self.serv.getsockname()
+        r, w = os.pipe()
+        with open(w, 'wb') as f:
+            f.write(self.FILEDATA[:self.PIPESIZE])
+        with socket.create_connection(address) as sock, open(r, 'rb') as file:
+            self.assertEqual(file.read(3), self.FILEDATA[:3])
+            sent = sock.sendfile(file, count=self.PIPESIZE - 10)
+            self.assertEqual(sent, self.PIPESIZE - 10)
+            self.assertEqual(file.read(), self.FILEDATA[self.PIPESIZE - 7:
+                                                      self.PIPESIZE])
+
+    def testPipe(self):
+        conn = self.accept_conn()
+        data = self.recv_data(conn)
+        self.assertEqual(data, self.FILEDATA[3:self.PIPESIZE - 7])
+
     # count
 
     def _testCount(self):
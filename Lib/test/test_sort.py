@@ -362,6 +362,36 @@ def test_unsafe_float_compare(self):
         check_against_PyObject_RichCompareBool(self, [float(x) for
                                                       x in range(100)])
 
+    def test_radix_sort(self):
+        # Large lists of bounded ints or of floats are radix sorted; the
+        # result, including the order of equal keys, must be the same.
+        n = 5000
+        rand = random.Random(0)
+        lists = [
+            [int(str(rand.randrange(-1000, 1000))) for _ in range(n)],
+            [rand.randrange(-(1<<29), 1<<29) for _ in range(n)],
+            [rand.choice([-0.0, 0.0, 1.5, -1.5]) * 1.0 for _ in range(n)],
+            [rand.uniform(-1e300, 1e300) for _ in range(n)],
+            [rand.choice([float('inf'), float('-inf'), 5e-324, -5e-324,
+                          rand.random()]) for _ in range(n)],
+            list(range(n, 0, -1)),
+            list(range(n)) + [-1],
+        ]
+        for L in lists:
+            check_against_PyObject_RichCompareBool(self, L)
+            for reverse in (False, True):
+                keyed = sorted(range(len(L)), key=L.__getitem__,
+                               reverse=reverse)
+                expected = sorted(range(len(L)),
+                                  key=cmp_to_key(lambda i, j: (L[i] > L[j]) -
+                                                              (L[i] < L[j])),
+                                  reverse=reverse)
+                self.assertEqual(keyed, expected)
+
+        # NaNs have no place in the order; the list is left to timsort.
+        L = [rand.random() for _ in range(n)] + [float('nan')]
+        check_against_PyObject_RichCompareBool(self, L)
+
     def test_unsafe_tuple_compare(self):
         # This test was suggested by Tim Peters. It verifies that the tuple
         # comparison respects the current tuple compare semantics, which do not
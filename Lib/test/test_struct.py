@@ -774,6 +774,121 @@ def test_error_propagation(fmt_str):
         test_error_propagation('N')
         test_error_propagation('n')
 
+class ColumnsTest(unittest.TestCase):
+    """
+    Tests for columnar packing and unpacking (struct.Struct.unpack_columns
+    and struct.Struct.pack_columns).
+    """
+
+    def test_roundtrip(self):
+        records = [(1, -2, 3.5, 7, True), (-1, 2, -0.25, 0, False),
+                   (2**31 - 1, -2**15, 1e100, 255, True)]
+        for byteorder in byteorders:
+            fmt = byteorder + 'ihdB?'
+            with self.subTest(format=fmt):
+                s = struct.Struct(fmt)
+                data = b''.join(s.pack(*r) for r in records)
+                columns = s.unpack_columns(data)
+                self.assertEqual(len(columns), 5)
+                for col in columns:
+                    self.assertIsInstance(col, memoryview)
+                    self.assertEqual(len(col), len(records))
+                self.assertEqual([list(col) for col in columns],
+                                 [list(c) for c in zip(*records)])
+                self.assertEqual(s.pack_columns(*columns), data)
+                self.assertEqual(s.pack_columns(*zip(*records)), data)
+
+    def test_column_format(self):
+        s = struct.Struct('<bBhHiIqQefd?x')
+        columns = s.unpack_columns(bytes(s.size * 2))
+        self.assertEqual([col.format for col in columns],
+                         ['b', 'B', 'h', 'H', 'i', 'I', 'q', 'Q', 'e', 'f',
+                          'd', '?'])
+        # Standard sizes are mapped to the native type of the same size
+        self.assertEqual(struct.unpack_columns('<l', bytes(8))[0].format,
+                         struct.unpack_columns('<i', bytes(8))[0].format)
+        self.assertEqual(struct.unpack_columns('<l', bytes(8))[0].itemsize, 4)
+
+    def test_strings(self):
+        s = struct.Struct('3s2p')
+        data = s.pack(b'ab', b'x') + s.pack(b'xyzw', b'')
+        columns = s.unpack_columns(data)
+        self.assertEqual(columns, ([b'ab\0', b'xyz'], [b'x', b'']))
+        self.assertEqual(s.pack_columns(*columns), data)
+
+    def test_bool(self):
+        s = struct.Struct('?')
+        self.assertEqual(list(s.unpack_columns(bytes([0, 1, 2, 255]))[0]),
+                         [False, True, True, True])
+        self.assertEqual(s.pack_columns([0, 'x', [], 3.5]),
+                         bytes([0, 1, 0, 1]))
+
+    def test_empty(self):
+        s = struct.Struct('<ih')
+        columns = s.unpack_columns(b'')
+        self.assertEqual([list(col) for col in columns], [[], []])
+        self.assertEqual(s.pack_columns([], []), b'')
+        s = struct.Struct('xx')
+        self.assertEqual(s.unpack_columns(b'\0' * 6), ())
+        self.assertEqual(s.pack_columns(), b'')
+
+    def test_errors(self):
+        s = struct.Struct('<ih')
+        with self.assertRaises(struct.error):
+            s.unpack_columns(b'123')
+        with self.assertRaises(struct.error):
+            s.unpack_columns(bytes(s.size + 1))
+        with self.assertRaises(struct.error):
+            struct.Struct('>').unpack_columns(b'')
+        with self.assertRaises(TypeError):
+            s.unpack_columns('123456')
+        with self.assertRaises(struct.error):
+            s.pack_columns([1, 2])
+        with self.assertRaises(struct.error):
+            s.pack_columns([1], [2], [3])
+        with self.assertRaises(struct.error):
+            s.pack_columns([1, 2], [3])
+        with self.assertRaises(TypeError):
+            s.pack_columns(1, 2)
+        with self.assertRaises(struct.error):
+            s.pack_columns([2**31], [0])
+        with self.assertRaises(struct.error):
+            s.pack_columns([0], ['x'])
+
+    def test_buffers(self):
+        s = struct.Struct('<iHd')
+        ints = array.array('i', [1, -2, 3])
+        shorts = memoryview(array.array('H', [4, 5, 6]))
+        doubles = array.array('d', [0.5, 1.5, 2.5])
+        data = s.pack_columns(ints, shorts, doubles)
+        self.assertEqual(data, b''.join(map(s.pack, ints, shorts, doubles)))
+        self.assertEqual(s.pack_columns(ints, [4, 5, 6], doubles.tolist()),
+                         data)
+        columns = s.unpack_columns(bytearray(data))
+        self.assertEqual(columns[0].tolist(), ints.tolist())
+        self.assertEqual(array.array('d', columns[2]), doubles)
+        # Unpacked columns are independent of the input buffer
+        buf = bytearray(data)
+        columns = s.unpack_columns(memoryview(buf))
+        buf[:] = bytes(len(buf))
+        self.assertEqual(columns[0].tolist(), ints.tolist())
+
+    def test_mutating_column(self):
+        class Evil:
+            def __index__(self):
+                column.clear()
+                return 1
+        s = struct.Struct('bb')
+        column = [Evil(), 2, 3]
+        with self.assertRaises(struct.error):
+            s.pack_columns(column, [1, 2, 3])
+
+    def test_module_func(self):
+        self.assertEqual(struct.pack_columns('>hB', [1, 2], [3, 4]),
+                         b'\0\1\3\0\2\4')
+        columns = struct.unpack_columns('>hB', b'\0\1\3\0\2\4')
+        self.assertEqual([list(col) for col in columns], [[1, 2], [3, 4]])
+
 class UnpackIteratorTest(unittest.TestCase):
     """
     Tests for iterative unpacking (struct.Struct.iter_unpack).
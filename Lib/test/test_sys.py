@@ -699,6 +699,21 @@ def __hash__(self):
 
         self.assertRaises(TypeError, sys.intern, S("abc"))
 
+    def test_intern_mortal(self):
+        # Strings interned by sys.intern() are removed from the interned
+        # dict once they are no longer referenced.
+        global INTERN_NUMRUNS
+        INTERN_NUMRUNS += 1
+        size = sys.getunicodeinternedsize()
+        strings = [sys.intern(f"mortal interned {i} {INTERN_NUMRUNS}")
+                   for i in range(100)]
+        self.assertGreaterEqual(sys.getunicodeinternedsize(), size + 100)
+        refcount = sys.getrefcount(strings[0])
+        self.assertIs(sys.intern(strings[0].swapcase().swapcase()), strings[0])
+        self.assertEqual(sys.getrefcount(strings[0]), refcount)
+        del strings
+        self.assertLess(sys.getunicodeinternedsize(), size + 100)
+
     def test_sys_flags(self):
         self.assertTrue(sys.flags)
         attrs = ("debug",
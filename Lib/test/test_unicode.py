@@ -2356,6 +2356,25 @@ def test_concatenation(self):
         self.assertEqual(("abc" "def" "ghi"), "abcdefghi")
         self.assertEqual(("abc" "def" "ghi"), "abcdefghi")
 
+    def test_concatenation_of_temporaries(self):
+        # Intermediate results of chained concatenation may be extended
+        # in place; make sure the operands themselves are never mutated.
+        def concat(a, b, c):
+            return a + b + c + b
+        a = 'x' * 10
+        b = 'y' * 20
+        for c in ('z', '\xe9', '€', '\U0001f40d', ''):
+            for _ in range(100):
+                self.assertEqual(concat(a, b, c),
+                                 'x' * 10 + 'y' * 20 + c + 'y' * 20)
+            self.assertEqual(a, 'x' * 10)
+            self.assertEqual(b, 'y' * 20)
+        s = 'a'
+        for _ in range(100):
+            t = s + 'b'
+            self.assertEqual(s, 'a')
+            self.assertEqual(t, 'ab')
+
     def test_ucs4(self):
         x = '\U00100000'
         y = x.encode("raw-unicode-escape").decode("raw-unicode-escape")
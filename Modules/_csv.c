@@ -129,6 +129,9 @@ typedef struct {
     Py_ssize_t field_len;       /* length of current field */
     int numeric_field;          /* treat field as numeric */
     unsigned long line_num;     /* Source-file line number */
+    Py_ssize_t field_index;     /* index of current field in record */
+    char *usecols;              /* selected fields, or NULL for all */
+    Py_ssize_t usecols_size;    /* size of usecols */
 } ReaderObj;
 
 typedef struct {
@@ -608,16 +611,26 @@ _call_dialect(_csvstate *module_state, PyObject *dialect_inst, PyObject *kwargs)
 /*
  * READER
  */
-static int
-parse_save_field(ReaderObj *self)
+
+/* Is the current field one of those selected by usecols? */
+static inline int
+parse_field_wanted(ReaderObj *self)
 {
-    PyObject *field;
+    return (self->usecols == NULL ||
+            (self->field_index < self->usecols_size &&
+             self->usecols[self->field_index]));
+}
 
-    field = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
-                                      (void *) self->field, self->field_len);
-    if (field == NULL)
-        return -1;
-    self->field_len = 0;
+/* Append a field to the record.  Steals the reference to field, which is
+   NULL if the field is not selected by usecols. */
+static int
+parse_append_field(ReaderObj *self, PyObject *field)
+{
+    self->field_index++;
+    if (field == NULL) {
+        self->numeric_field = 0;
+        return 0;
+    }
     if (self->numeric_field) {
         PyObject *tmp;
 
@@ -636,6 +649,22 @@ parse_save_field(ReaderObj *self)
     return 0;
 }
 
+static int
+parse_save_field(ReaderObj *self)
+{
+    PyObject *field = NULL;
+
+    if (parse_field_wanted(self)) {
+        field = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
+                                          (void *) self->field,
+                                          self->field_len);
+        if (field == NULL)
+            return -1;
+    }
+    self->field_len = 0;
+    return parse_append_field(self, field);
+}
+
 static int
 parse_grow_buff(ReaderObj *self)
 {
@@ -662,12 +691,127 @@ parse_add_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
                      module_state->field_limit);
         return -1;
     }
+    if (!parse_field_wanted(self)) {
+        /* The field is skipped: only count its length */
+        self->field_len++;
+        return 0;
+    }
     if (self->field_len == self->field_size && !parse_grow_buff(self))
         return -1;
     self->field[self->field_len++] = c;
     return 0;
 }
 
+/* Add the characters data[start:end] to the field, as parse_add_char()
+   would do for each of them. */
+static int
+parse_add_run(ReaderObj *self, _csvstate *module_state,
+              int kind, const void *data, Py_ssize_t start, Py_ssize_t end)
+{
+    Py_ssize_t n = end - start;
+    Py_UCS4 *dest;
+
+    if (n > module_state->field_limit - self->field_len) {
+        PyErr_Format(module_state->error_obj,
+                     "field larger than field limit (%ld)",
+                     module_state->field_limit);
+        return -1;
+    }
+    if (!parse_field_wanted(self)) {
+        self->field_len += n;
+        return 0;
+    }
+    while (n > self->field_size - self->field_len) {
+        if (!parse_grow_buff(self))
+            return -1;
+    }
+    dest = self->field + self->field_len;
+    switch (kind) {
+    case PyUnicode_1BYTE_KIND: {
+        const Py_UCS1 *src = (const Py_UCS1 *)data + start;
+        for (Py_ssize_t i = 0; i < n; i++)
+            dest[i] = src[i];
+        break;
+    }
+    case PyUnicode_2BYTE_KIND: {
+        const Py_UCS2 *src = (const Py_UCS2 *)data + start;
+        for (Py_ssize_t i = 0; i < n; i++)
+            dest[i] = src[i];
+        break;
+    }
+    default:
+        memcpy(dest, (const Py_UCS4 *)data + start, n * sizeof(Py_UCS4));
+        break;
+    }
+    self->field_len += n;
+    return 0;
+}
+
+/* Return the position of the first character in data[pos:end] which is
+   one of c1, c2, c3 or c4, or end if there is none. */
+static Py_ssize_t
+parse_scan(int kind, const void *data, Py_ssize_t pos, Py_ssize_t end,
+           Py_UCS4 c1, Py_UCS4 c2, Py_UCS4 c3, Py_UCS4 c4)
+{
+#define SCAN(TYPE)                                              \
+    do {                                                        \
+        const TYPE *p = (const TYPE *)data;                     \
+        for (; pos < end; pos++) {                              \
+            Py_UCS4 c = p[pos];                                 \
+            if (c == c1 || c == c2 || c == c3 || c == c4)       \
+                break;                                          \
+        }                                                       \
+    } while (0)
+
+    switch (kind) {
+    case PyUnicode_1BYTE_KIND:
+        SCAN(Py_UCS1);
+        break;
+    case PyUnicode_2BYTE_KIND:
+        SCAN(Py_UCS2);
+        break;
+    default:
+        SCAN(Py_UCS4);
+        break;
+    }
+    return pos;
+#undef SCAN
+}
+
+/* Skip over the run of ordinary characters starting at pos in the current
+   state, which is IN_FIELD or IN_QUOTED_FIELD.  Return the position of the
+   next character which must go through parse_process_char(). */
+static Py_ssize_t
+parse_scan_field(ReaderObj *self, int kind, const void *data,
+                 Py_ssize_t pos, Py_ssize_t end)
+{
+    DialectObj *dialect = self->dialect;
+
+    if (self->state == IN_FIELD) {
+        return parse_scan(kind, data, pos, end, '\n', '\r',
+                          dialect->delimiter, dialect->escapechar);
+    }
+    assert(self->state == IN_QUOTED_FIELD);
+    if (dialect->quoting == QUOTE_NONE) {
+        return parse_scan(kind, data, pos, end, dialect->escapechar,
+                          dialect->escapechar, dialect->escapechar,
+                          dialect->escapechar);
+    }
+    return parse_scan(kind, data, pos, end, dialect->quotechar,
+                      dialect->quotechar, dialect->quotechar,
+                      dialect->escapechar);
+}
+
+/* Can c begin an unquoted field in the START_RECORD or START_FIELD state? */
+static inline int
+parse_starts_plain_field(DialectObj *dialect, Py_UCS4 c)
+{
+    return (c != '\n' && c != '\r' &&
+            c != dialect->delimiter && c != dialect->escapechar &&
+            (c != dialect->quotechar || dialect->quoting == QUOTE_NONE) &&
+            (c != ' ' || !dialect->skipinitialspace));
+}
+
 static int
 parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 {
@@ -850,6 +994,78 @@ parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
     return 0;
 }
 
+/* Feed the characters of line to the parser.  Return -1 on error.
+   Runs of ordinary characters are copied to the field buffer in bulk, and
+   unquoted fields which are fully contained in the line are sliced from it
+   directly.  Everything else goes through parse_process_char(). */
+static int
+parse_line(ReaderObj *self, _csvstate *module_state, PyObject *line)
+{
+    DialectObj *dialect = self->dialect;
+    int kind = PyUnicode_KIND(line);
+    const void *data = PyUnicode_DATA(line);
+    Py_ssize_t pos = 0, end;
+    Py_ssize_t linelen = PyUnicode_GET_LENGTH(line);
+    Py_UCS4 c;
+
+    while (pos < linelen) {
+        c = PyUnicode_READ(kind, data, pos);
+        if ((self->state == START_RECORD || self->state == START_FIELD) &&
+            parse_starts_plain_field(dialect, c))
+        {
+            /* Unquoted field */
+            if (dialect->quoting == QUOTE_NONNUMERIC)
+                self->numeric_field = 1;
+            self->state = IN_FIELD;
+            end = parse_scan_field(self, kind, data, pos + 1, linelen);
+            if (end < linelen) {
+                c = PyUnicode_READ(kind, data, end);
+                if (c != dialect->escapechar) {
+                    /* The whole field is in the line: slice it */
+                    PyObject *field = NULL;
+
+                    assert(self->field_len == 0);
+                    if (end - pos > module_state->field_limit) {
+                        PyErr_Format(module_state->error_obj,
+                                     "field larger than field limit (%ld)",
+                                     module_state->field_limit);
+                        return -1;
+                    }
+                    if (parse_field_wanted(self)) {
+                        field = PyUnicode_Substring(line, pos, end);
+                        if (field == NULL)
+                            return -1;
+                    }
+                    if (parse_append_field(self, field) < 0)
+                        return -1;
+                    self->state = ((c == '\n' || c == '\r') ? EAT_CRNL
+                                                            : START_FIELD);
+                    pos = end + 1;
+                    continue;
+                }
+            }
+            if (parse_add_run(self, module_state, kind, data, pos, end) < 0)
+                return -1;
+            pos = end;
+            continue;
+        }
+        if (self->state == IN_FIELD || self->state == IN_QUOTED_FIELD) {
+            end = parse_scan_field(self, kind, data, pos, linelen);
+            if (end > pos) {
+                if (parse_add_run(self, module_state, kind, data,
+                                  pos, end) < 0)
+                    return -1;
+                pos = end;
+                continue;
+            }
+        }
+        if (parse_process_char(self, module_state, c) < 0)
+            return -1;
+        pos++;
+    }
+    return 0;
+}
+
 static int
 parse_reset(ReaderObj *self)
 {
@@ -859,6 +1075,7 @@ parse_reset(ReaderObj *self)
     self->field_len = 0;
     self->state = START_RECORD;
     self->numeric_field = 0;
+    self->field_index = 0;
     return 0;
 }
 
@@ -866,10 +1083,6 @@ static PyObject *
 Reader_iternext(ReaderObj *self)
 {
     PyObject *fields = NULL;
-    Py_UCS4 c;
-    Py_ssize_t pos, linelen;
-    int kind;
-    const void *data;
     PyObject *lineobj;
 
     _csvstate *module_state = _csv_state_from_type(Py_TYPE(self),
@@ -909,17 +1122,9 @@ Reader_iternext(ReaderObj *self)
             return NULL;
         }
         ++self->line_num;
-        kind = PyUnicode_KIND(lineobj);
-        data = PyUnicode_DATA(lineobj);
-        pos = 0;
-        linelen = PyUnicode_GET_LENGTH(lineobj);
-        while (linelen--) {
-            c = PyUnicode_READ(kind, data, pos);
-            if (parse_process_char(self, module_state, c) < 0) {
-                Py_DECREF(lineobj);
-                goto err;
-            }
-            pos++;
+        if (parse_line(self, module_state, lineobj) < 0) {
+            Py_DECREF(lineobj);
+            goto err;
         }
         Py_DECREF(lineobj);
         if (parse_process_char(self, module_state, EOL) < 0)
@@ -942,6 +1147,7 @@ Reader_dealloc(ReaderObj *self)
         PyMem_Free(self->field);
         self->field = NULL;
     }
+    PyMem_Free(self->usecols);
     PyObject_GC_Del(self);
     Py_DECREF(tp);
 }
@@ -1005,10 +1211,67 @@ PyType_Spec Reader_Type_spec = {
 };
 
 
+/* Convert the usecols argument of reader() to a table of flags indexed by
+   field number. */
+static int
+reader_set_usecols(ReaderObj *self, PyObject *usecols)
+{
+    PyObject *seq;
+    Py_ssize_t i, n, size = 0;
+
+    if (usecols == Py_None) {
+        return 0;
+    }
+    seq = PySequence_Fast(usecols, "usecols must be an iterable of integers");
+    if (seq == NULL) {
+        return -1;
+    }
+    n = PySequence_Fast_GET_SIZE(seq);
+    Py_ssize_t *indices = PyMem_New(Py_ssize_t, n);
+    if (indices == NULL) {
+        Py_DECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < n; i++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(seq, i);
+        indices[i] = PyNumber_AsSsize_t(item, PyExc_OverflowError);
+        if (indices[i] == -1 && PyErr_Occurred()) {
+            goto error;
+        }
+        if (indices[i] < 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "usecols must contain non-negative integers");
+            goto error;
+        }
+        if (indices[i] >= size) {
+            size = indices[i] + 1;
+        }
+    }
+    /* Always allocate at least one byte: usecols=() selects no field */
+    self->usecols = PyMem_Calloc(size ? size : 1, 1);
+    if (self->usecols == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    for (i = 0; i < n; i++) {
+        self->usecols[indices[i]] = 1;
+    }
+    self->usecols_size = size;
+    PyMem_Free(indices);
+    Py_DECREF(seq);
+    return 0;
+
+error:
+    PyMem_Free(indices);
+    Py_DECREF(seq);
+    return -1;
+}
+
 static PyObject *
 csv_reader(PyObject *module, PyObject *args, PyObject *keyword_args)
 {
-    PyObject * iterator, * dialect = NULL;
+    PyObject * iterator, * dialect = NULL, * usecols;
     _csvstate *module_state = get_csv_state(module);
     ReaderObj * self = PyObject_GC_New(
         ReaderObj,
@@ -1023,6 +1286,8 @@ csv_reader(PyObject *module, PyObject *args, PyObject *keyword_args)
     self->field = NULL;
     self->field_size = 0;
     self->line_num = 0;
+    self->usecols = NULL;
+    self->usecols_size = 0;
 
     if (parse_reset(self) < 0) {
         Py_DECREF(self);
@@ -1038,12 +1303,40 @@ csv_reader(PyObject *module, PyObject *args, PyObject *keyword_args)
         Py_DECREF(self);
         return NULL;
     }
+    /* usecols is an option of the reader, not of the dialect */
+    if (keyword_args != NULL &&
+        (usecols = PyDict_GetItemString(keyword_args, "usecols")) != NULL)
+    {
+        Py_INCREF(usecols);
+        keyword_args = PyDict_Copy(keyword_args);
+        if (keyword_args == NULL ||
+            PyDict_DelItemString(keyword_args, "usecols") < 0) {
+            Py_XDECREF(keyword_args);
+            Py_DECREF(usecols);
+            Py_DECREF(self);
+            return NULL;
+        }
+    }
+    else {
+        usecols = NULL;
+        Py_XINCREF(keyword_args);
+    }
     self->dialect = (DialectObj *)_call_dialect(module_state, dialect,
                                                 keyword_args);
+    Py_XDECREF(keyword_args);
     if (self->dialect == NULL) {
+        Py_XDECREF(usecols);
         Py_DECREF(self);
         return NULL;
     }
+    if (usecols != NULL) {
+        int rc = reader_set_usecols(self, usecols);
+        Py_DECREF(usecols);
+        if (rc < 0) {
+            Py_DECREF(self);
+            return NULL;
+        }
+    }
 
     PyObject_GC_Track(self);
     return (PyObject *)self;
@@ -1693,6 +1986,9 @@ PyDoc_STRVAR(csv_reader_doc,
 "also accepts optional keyword arguments which override settings\n"
 "provided by the dialect.\n"
 "\n"
+"The optional \"usecols\" keyword argument is an iterable of field\n"
+"indices.  If given, only these fields are included in the rows.\n"
+"\n"
 "The returned object is an iterator.  Each iteration returns a row\n"
 "of the CSV file (which can span multiple input lines).\n");
 
@@ -588,6 +588,7 @@ iomodule_traverse(PyObject *mod, visitproc visit, void *arg) {
     Py_VISIT(state->PyBufferedReader_Type);
     Py_VISIT(state->PyBufferedWriter_Type);
     Py_VISIT(state->PyBytesIO_Type);
+    Py_VISIT(state->PyFastDecoder_Type);
     Py_VISIT(state->PyFileIO_Type);
     Py_VISIT(state->PyStringIO_Type);
     Py_VISIT(state->PyTextIOWrapper_Type);
@@ -609,6 +610,7 @@ iomodule_clear(PyObject *mod) {
     Py_CLEAR(state->PyBufferedReader_Type);
     Py_CLEAR(state->PyBufferedWriter_Type);
     Py_CLEAR(state->PyBytesIO_Type);
+    Py_CLEAR(state->PyFastDecoder_Type);
     Py_CLEAR(state->PyFileIO_Type);
     Py_CLEAR(state->PyStringIO_Type);
     Py_CLEAR(state->PyTextIOWrapper_Type);
@@ -753,6 +755,9 @@ PyInit__io(void)
         }
     }
 
+    // Private decoder used by TextIOWrapper
+    ADD_TYPE(m, state->PyFastDecoder_Type, &fastdecoder_spec, NULL);
+
     // PyBufferedIOBase_Type(PyIOBase_Type) subclasses
     ADD_TYPE(m, state->PyBytesIO_Type, &bytesio_spec, &PyBufferedIOBase_Type);
     ADD_TYPE(m, state->PyBufferedWriter_Type, &bufferedwriter_spec,
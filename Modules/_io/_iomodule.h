@@ -22,6 +22,7 @@ extern PyType_Spec bufferedreader_spec;
 extern PyType_Spec bufferedrwpair_spec;
 extern PyType_Spec bufferedwriter_spec;
 extern PyType_Spec bytesio_spec;
+extern PyType_Spec fastdecoder_spec;
 extern PyType_Spec fileio_spec;
 extern PyType_Spec stringio_spec;
 extern PyType_Spec textiowrapper_spec;
@@ -49,6 +50,10 @@ extern int _PyIOBase_finalize(PyObject *self);
    Doesn't check the argument type, so be careful! */
 extern int _PyFileIO_closed(PyObject *self);
 
+/* Returns the file descriptor of the given FileIO object, or -1 if it is
+   closed.  Doesn't check the argument type either. */
+extern int _PyFileIO_fd(PyObject *self);
+
 /* Shortcut to the core of the IncrementalNewlineDecoder.decode method */
 extern PyObject *_PyIncrementalNewlineDecoder_decode(
     PyObject *self, PyObject *input, int final);
@@ -152,6 +157,7 @@ typedef struct {
     PyTypeObject *PyBufferedReader_Type;
     PyTypeObject *PyBufferedWriter_Type;
     PyTypeObject *PyBytesIO_Type;
+    PyTypeObject *PyFastDecoder_Type;
     PyTypeObject *PyFileIO_Type;
     PyTypeObject *PyStringIO_Type;
     PyTypeObject *PyTextIOWrapper_Type;
@@ -10,10 +10,15 @@
 #define PY_SSIZE_T_CLEAN
 #include "Python.h"
 #include "pycore_call.h"          // _PyObject_CallNoArgs()
+#include "pycore_fileutils.h"     // _PY_READ_MAX
 #include "pycore_object.h"
 #include "structmember.h"         // PyMemberDef
 #include "_iomodule.h"
 
+#ifdef HAVE_SYS_UIO_H
+#  include <sys/uio.h>             // readv()
+#endif
+
 /*[clinic input]
 module _io
 class _io._BufferedIOBase "PyObject *" "&PyBufferedIOBase_Type"
@@ -619,6 +624,13 @@ static PyObject *
 _bufferedreader_read_generic(buffered *self, Py_ssize_t);
 static Py_ssize_t
 _bufferedreader_raw_read(buffered *self, char *start, Py_ssize_t len);
+#ifdef HAVE_READV
+static int
+_bufferedreader_readv_fd(buffered *self);
+static Py_ssize_t
+_bufferedreader_raw_readv(buffered *self, int fd, char *start,
+                          Py_ssize_t len);
+#endif
 
 /*
  * Helpers
@@ -976,9 +988,23 @@ _buffered_readinto_generic(buffered *self, Py_buffer *buffer, char readinto1)
     _bufferedreader_reset_buf(self);
     self->pos = 0;
 
+#ifdef HAVE_READV
+    int fd = _bufferedreader_readv_fd(self);
+#endif
+
     for (remaining = buffer->len - written;
          remaining > 0;
          written += n, remaining -= n) {
+#ifdef HAVE_READV
+        /* Read directly into caller's buffer, and the rest of the block
+         * into the internal buffer. */
+        if (fd >= 0 && !(readinto1 && written)) {
+            n = _bufferedreader_raw_readv(self, fd,
+                                          (char *) buffer->buf + written,
+                                          remaining);
+        }
+        else
+#endif
         /* If remaining bytes is larger than internal buffer size, copy
          * directly into caller's buffer. */
         if (remaining > self->buffer_size) {
@@ -1055,9 +1081,10 @@ static PyObject *
 _buffered_readline(buffered *self, Py_ssize_t limit)
 {
     PyObject *res = NULL;
-    PyObject *chunks = NULL;
+    _PyBytesWriter writer;
+    char *out;
     Py_ssize_t n;
-    const char *start, *s, *end;
+    const char *start, *s;
 
     CHECK_CLOSED(self, "readline of closed file")
 
@@ -1085,19 +1112,17 @@ _buffered_readline(buffered *self, Py_ssize_t limit)
     if (!ENTER_BUFFERED(self))
         goto end_unlocked;
 
-    /* Now we try to get some more from the raw stream */
-    chunks = PyList_New(0);
-    if (chunks == NULL)
-        goto end;
+    /* Now we try to get some more from the raw stream.  The line is
+       accumulated in a bytes writer, so that it is only copied once
+       however many times the buffer has to be refilled. */
+    _PyBytesWriter_Init(&writer);
+    writer.overallocate = 1;
+    out = _PyBytesWriter_Alloc(&writer, n);
+    if (out == NULL)
+        goto error;
     if (n > 0) {
-        res = PyBytes_FromStringAndSize(start, n);
-        if (res == NULL)
-            goto end;
-        if (PyList_Append(chunks, res) < 0) {
-            Py_CLEAR(res);
-            goto end;
-        }
-        Py_CLEAR(res);
+        memcpy(out, start, n);
+        out += n;
         self->pos += n;
         if (limit >= 0)
             limit -= n;
@@ -1105,7 +1130,7 @@ _buffered_readline(buffered *self, Py_ssize_t limit)
     if (self->writable) {
         PyObject *r = buffered_flush_and_rewind_unlocked(self);
         if (r == NULL)
-            goto end;
+            goto error;
         Py_DECREF(r);
     }
 
@@ -1113,49 +1138,32 @@ _buffered_readline(buffered *self, Py_ssize_t limit)
         _bufferedreader_reset_buf(self);
         n = _bufferedreader_fill_buffer(self);
         if (n == -1)
-            goto end;
+            goto error;
         if (n <= 0)
             break;
         if (limit >= 0 && n > limit)
             n = limit;
         start = self->buffer;
-        end = start + n;
-        s = start;
-        while (s < end) {
-            if (*s++ == '\n') {
-                res = PyBytes_FromStringAndSize(start, s - start);
-                if (res == NULL)
-                    goto end;
-                self->pos = s - start;
-                goto found;
-            }
-        }
-        res = PyBytes_FromStringAndSize(start, n);
-        if (res == NULL)
-            goto end;
-        if (n == limit) {
-            self->pos = n;
+        s = memchr(start, '\n', n);
+        if (s != NULL)
+            n = s - start + 1;
+        out = _PyBytesWriter_WriteBytes(&writer, out, start, n);
+        if (out == NULL)
+            goto error;
+        self->pos = n;
+        if (s != NULL || n == limit)
             break;
-        }
-        if (PyList_Append(chunks, res) < 0) {
-            Py_CLEAR(res);
-            goto end;
-        }
-        Py_CLEAR(res);
         if (limit >= 0)
             limit -= n;
     }
-found:
-    if (res != NULL && PyList_Append(chunks, res) < 0) {
-        Py_CLEAR(res);
-        goto end;
-    }
-    Py_XSETREF(res, _PyBytes_Join((PyObject *)&_Py_SINGLETON(bytes_empty), chunks));
+    res = _PyBytesWriter_Finish(&writer, out);
+    goto end;
 
+error:
+    _PyBytesWriter_Dealloc(&writer);
 end:
     LEAVE_BUFFERED(self)
 end_unlocked:
-    Py_XDECREF(chunks);
     return res;
 }
 
@@ -1491,6 +1499,67 @@ _bufferedreader_raw_read(buffered *self, char *start, Py_ssize_t len)
     return n;
 }
 
+#ifdef HAVE_READV
+/* Return the file descriptor to read from with _bufferedreader_raw_readv(),
+   or -1 if the raw stream is not a plain, open FileIO.  The descriptor is
+   taken from the FileIO object rather than through its fileno() method. */
+static int
+_bufferedreader_readv_fd(buffered *self)
+{
+    if (!self->fast_closed_checks)
+        return -1;
+    return _PyFileIO_fd(self->raw);
+}
+
+/* Read up to len bytes into start, and whatever follows them, up to a
+   whole buffer, into the (empty) buffer, in a single readv() call on the
+   file descriptor of a FileIO raw stream.  This saves a system call and
+   the copy out of the buffer when a read ends inside a block.  Returns
+   the number of bytes stored at start, or the same codes as
+   _bufferedreader_raw_read(). */
+static Py_ssize_t
+_bufferedreader_raw_readv(buffered *self, int fd, char *start,
+                          Py_ssize_t len)
+{
+    struct iovec iov[2];
+    Py_ssize_t n;
+    int async_err = 0;
+
+    /* Like FileIO.readinto(), keep the total size of the read below
+       _PY_READ_MAX: readv() fails with EINVAL on macOS if it exceeds
+       INT_MAX.  The callers loop over short reads. */
+    if (len > _PY_READ_MAX - self->buffer_size)
+        len = _PY_READ_MAX - self->buffer_size;
+    iov[0].iov_base = start;
+    iov[0].iov_len = len;
+    iov[1].iov_base = self->buffer;
+    iov[1].iov_len = self->buffer_size;
+    do {
+        Py_BEGIN_ALLOW_THREADS
+        n = readv(fd, iov, 2);
+        Py_END_ALLOW_THREADS
+    } while (n < 0 && errno == EINTR &&
+             !(async_err = PyErr_CheckSignals()));
+    if (async_err)
+        return -1;
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+            return -2;
+        PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    if (n > 0 && self->abs_pos != -1)
+        self->abs_pos += n;
+    if (n > len) {
+        self->pos = 0;
+        self->read_end = n - len;
+        self->raw_pos = n - len;
+        n = len;
+    }
+    return n;
+}
+#endif
+
 static Py_ssize_t
 _bufferedreader_fill_buffer(buffered *self)
 {
@@ -1650,9 +1719,31 @@ _bufferedreader_read_generic(buffered *self, Py_ssize_t n)
         Py_DECREF(r);
     }
     _bufferedreader_reset_buf(self);
+#ifdef HAVE_READV
+    int fd = _bufferedreader_readv_fd(self);
+    while (fd >= 0) {
+        if (remaining == 0)
+            return res;
+        Py_ssize_t r = _bufferedreader_raw_readv(self, fd, out + written,
+                                                 remaining);
+        if (r == -1)
+            goto error;
+        if (r == 0 || r == -2) {
+            /* EOF occurred or read() would block. */
+            if (r == 0 || written > 0) {
+                if (_PyBytes_Resize(&res, written))
+                    goto error;
+                return res;
+            }
+            Py_DECREF(res);
+            Py_RETURN_NONE;
+        }
+        remaining -= r;
+        written += r;
+    }
+#endif
     while (remaining > 0) {
-        /* We want to read a whole block at the end into buffer.
-           If we had readv() we could do this in one pass. */
+        /* We want to read a whole block at the end into buffer. */
         Py_ssize_t r = MINUS_LAST_BLOCK(self, remaining);
         if (r == 0)
             break;
@@ -8,6 +8,113 @@ preserve
 #endif
 
 
+PyDoc_STRVAR(_io__FastDecoder_decode__doc__,
+"decode($self, /, input, final=False)\n"
+"--\n"
+"\n");
+
+#define _IO__FASTDECODER_DECODE_METHODDEF    \
+    {"decode", _PyCFunction_CAST(_io__FastDecoder_decode), METH_FASTCALL|METH_KEYWORDS, _io__FastDecoder_decode__doc__},
+
+static PyObject *
+_io__FastDecoder_decode_impl(fastdecoder_object *self, PyObject *input,
+                             int final);
+
+static PyObject *
+_io__FastDecoder_decode(fastdecoder_object *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(input), &_Py_ID(final), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"input", "final", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "decode",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 1;
+    PyObject *input;
+    int final = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 2, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    input = args[0];
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    final = PyObject_IsTrue(args[1]);
+    if (final < 0) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = _io__FastDecoder_decode_impl(self, input, final);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_io__FastDecoder_getstate__doc__,
+"getstate($self, /)\n"
+"--\n"
+"\n");
+
+#define _IO__FASTDECODER_GETSTATE_METHODDEF    \
+    {"getstate", (PyCFunction)_io__FastDecoder_getstate, METH_NOARGS, _io__FastDecoder_getstate__doc__},
+
+static PyObject *
+_io__FastDecoder_getstate_impl(fastdecoder_object *self);
+
+static PyObject *
+_io__FastDecoder_getstate(fastdecoder_object *self, PyObject *Py_UNUSED(ignored))
+{
+    return _io__FastDecoder_getstate_impl(self);
+}
+
+PyDoc_STRVAR(_io__FastDecoder_setstate__doc__,
+"setstate($self, state, /)\n"
+"--\n"
+"\n");
+
+#define _IO__FASTDECODER_SETSTATE_METHODDEF    \
+    {"setstate", (PyCFunction)_io__FastDecoder_setstate, METH_O, _io__FastDecoder_setstate__doc__},
+
+PyDoc_STRVAR(_io__FastDecoder_reset__doc__,
+"reset($self, /)\n"
+"--\n"
+"\n");
+
+#define _IO__FASTDECODER_RESET_METHODDEF    \
+    {"reset", (PyCFunction)_io__FastDecoder_reset, METH_NOARGS, _io__FastDecoder_reset__doc__},
+
+static PyObject *
+_io__FastDecoder_reset_impl(fastdecoder_object *self);
+
+static PyObject *
+_io__FastDecoder_reset(fastdecoder_object *self, PyObject *Py_UNUSED(ignored))
+{
+    return _io__FastDecoder_reset_impl(self);
+}
+
 PyDoc_STRVAR(_io_IncrementalNewlineDecoder___init____doc__,
 "IncrementalNewlineDecoder(decoder, translate, errors=\'strict\')\n"
 "--\n"
@@ -769,4 +876,4 @@ _io_TextIOWrapper_close(textio *self, PyObject *Py_UNUSED(ignored))
 {
     return _io_TextIOWrapper_close_impl(self);
 }
-/*[clinic end generated code: output=73f84b13c343b34b input=a9049054013a1b77]*/
+/*[clinic end generated code: output=e4bd9672b1d5fc74 input=a9049054013a1b77]*/
@@ -83,6 +83,12 @@ _PyFileIO_closed(PyObject *self)
     return ((fileio *)self)->fd < 0;
 }
 
+int
+_PyFileIO_fd(PyObject *self)
+{
+    return ((fileio *)self)->fd;
+}
+
 /* Because this can call arbitrary code, it shouldn't be called when
    the refcount is 0 (that is, not directly from tp_dealloc unless
    the refcount has been temporarily re-incremented). */
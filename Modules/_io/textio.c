@@ -1,7 +1,8 @@
 /*
     An implementation of Text I/O as defined by PEP 3116 - "New I/O"
 
-    Classes defined here: TextIOBase, IncrementalNewlineDecoder, TextIOWrapper.
+    Classes defined here: TextIOBase, IncrementalNewlineDecoder, TextIOWrapper
+    and the private _FastDecoder.
 
     Written by Amaury Forgeot d'Arc and Antoine Pitrou
 */
@@ -13,15 +14,17 @@
 #include "pycore_fileutils.h"     // _Py_GetLocaleEncoding()
 #include "pycore_object.h"
 #include "pycore_pystate.h"       // _PyInterpreterState_GET()
+#include "pycore_unicodeobject.h" // _PyUnicode_GetCachedUTF8()
 #include "structmember.h"         // PyMemberDef
 #include "_iomodule.h"
 
 /*[clinic input]
 module _io
 class _io.IncrementalNewlineDecoder "nldecoder_object *" "&PyIncrementalNewlineDecoder_Type"
+class _io._FastDecoder "fastdecoder_object *" "clinic_state()->PyFastDecoder_Type"
 class _io.TextIOWrapper "textio *" "clinic_state()->TextIOWrapper_Type"
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=d3f032e90f74c8f2]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=efc418941aed5820]*/
 
 /* TextIOBase */
 
@@ -198,6 +201,213 @@ PyTypeObject PyTextIOBase_Type = {
 };
 
 
+/* _FastDecoder: incremental decoder for the codecs that TextIOWrapper can
+   decode without calling into the codec's Python incremental decoder.  Its
+   state has the same form as that of the decoder it replaces. */
+
+typedef PyObject *
+        (*decodefunc_t)(const char *, Py_ssize_t, const char *, Py_ssize_t *);
+
+static PyObject *
+ascii_decode(const char *s, Py_ssize_t size, const char *errors,
+             Py_ssize_t *consumed)
+{
+    if (consumed != NULL)
+        *consumed = size;
+    return PyUnicode_DecodeASCII(s, size, errors);
+}
+
+static PyObject *
+latin1_decode(const char *s, Py_ssize_t size, const char *errors,
+              Py_ssize_t *consumed)
+{
+    if (consumed != NULL)
+        *consumed = size;
+    return PyUnicode_DecodeLatin1(s, size, errors);
+}
+
+/* Map normalized encoding names onto the specialized decoding funcs */
+
+typedef struct {
+    const char *name;
+    decodefunc_t decodefunc;
+} decodefuncentry;
+
+static const decodefuncentry decodefuncs[] = {
+    {"ascii",       ascii_decode},
+    {"iso8859-1",   latin1_decode},
+    {"utf-8",       PyUnicode_DecodeUTF8Stateful},
+    {NULL, NULL}
+};
+
+typedef struct {
+    PyObject_HEAD
+    decodefunc_t decodefunc;
+    PyObject *errors;
+    PyObject *pending;  /* input not decoded yet, or NULL */
+} fastdecoder_object;
+
+static void fastdecoder_dealloc(fastdecoder_object *self);
+
+/* The type is a per-module heap type: recognize its instances by their
+   deallocator, where no module state is at hand.  It has no subclasses. */
+#define FastDecoder_Check(op) \
+    (Py_TYPE(op)->tp_dealloc == (destructor)fastdecoder_dealloc)
+
+/* Return a decoder for the codec named name, or None if it has no
+   specialized decoding function. */
+static PyObject *
+_PyFastDecoder_New(_PyIO_State *state, PyObject *name, const char *errors)
+{
+    const decodefuncentry *e = decodefuncs;
+    fastdecoder_object *self;
+
+    while (e->name != NULL) {
+        if (_PyUnicode_EqualToASCIIString(name, e->name))
+            break;
+        e++;
+    }
+    if (e->name == NULL)
+        Py_RETURN_NONE;
+
+    self = PyObject_New(fastdecoder_object, state->PyFastDecoder_Type);
+    if (self == NULL)
+        return NULL;
+    self->decodefunc = e->decodefunc;
+    self->pending = NULL;
+    self->errors = PyUnicode_FromString(errors);
+    if (self->errors == NULL) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+static void
+fastdecoder_dealloc(fastdecoder_object *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    Py_XDECREF(self->errors);
+    Py_XDECREF(self->pending);
+    tp->tp_free(self);
+    Py_DECREF(tp);
+}
+
+/* Shortcut to the core of the _FastDecoder.decode method */
+static PyObject *
+_PyFastDecoder_decode(PyObject *myself, PyObject *input, int final)
+{
+    fastdecoder_object *self = (fastdecoder_object *) myself;
+    PyObject *data = NULL, *output, *pending = NULL;
+    const char *errors, *s;
+    Py_ssize_t size, consumed;
+    Py_buffer view;
+
+    errors = PyUnicode_AsUTF8(self->errors);
+    if (errors == NULL)
+        return NULL;
+    if (PyObject_GetBuffer(input, &view, PyBUF_SIMPLE) < 0)
+        return NULL;
+    s = view.buf;
+    size = view.len;
+    if (self->pending != NULL) {
+        /* Prefix input with the end of the previous one */
+        Py_ssize_t npending = PyBytes_GET_SIZE(self->pending);
+        data = PyBytes_FromStringAndSize(NULL, npending + size);
+        if (data == NULL) {
+            PyBuffer_Release(&view);
+            return NULL;
+        }
+        memcpy(PyBytes_AS_STRING(data),
+               PyBytes_AS_STRING(self->pending), npending);
+        memcpy(PyBytes_AS_STRING(data) + npending, s, size);
+        s = PyBytes_AS_STRING(data);
+        size += npending;
+    }
+
+    consumed = size;
+    output = self->decodefunc(s, size, errors, final ? NULL : &consumed);
+    if (output != NULL && consumed < size) {
+        pending = PyBytes_FromStringAndSize(s + consumed, size - consumed);
+        if (pending == NULL)
+            Py_CLEAR(output);
+    }
+    if (output != NULL)
+        Py_XSETREF(self->pending, pending);
+    Py_XDECREF(data);
+    PyBuffer_Release(&view);
+    return output;
+}
+
+/*[clinic input]
+_io._FastDecoder.decode
+    input: object
+    final: bool = False
+[clinic start generated code]*/
+
+static PyObject *
+_io__FastDecoder_decode_impl(fastdecoder_object *self, PyObject *input,
+                             int final)
+/*[clinic end generated code: output=b0bd2eaa095d5e1f input=4ee3b9f8c1b1d570]*/
+{
+    return _PyFastDecoder_decode((PyObject *) self, input, final);
+}
+
+/*[clinic input]
+_io._FastDecoder.getstate
+[clinic start generated code]*/
+
+static PyObject *
+_io__FastDecoder_getstate_impl(fastdecoder_object *self)
+/*[clinic end generated code: output=ab4b70fd3f3d01a0 input=a463dd406304b0df]*/
+{
+    if (self->pending == NULL)
+        return Py_BuildValue("(yi)", "", 0);
+    return Py_BuildValue("(Oi)", self->pending, 0);
+}
+
+/*[clinic input]
+_io._FastDecoder.setstate
+    state: object
+    /
+[clinic start generated code]*/
+
+static PyObject *
+_io__FastDecoder_setstate(fastdecoder_object *self, PyObject *state)
+/*[clinic end generated code: output=a0922c908d6885d3 input=5a72cbc4b4099148]*/
+{
+    PyObject *buffer;
+    int flag;
+
+    if (!PyTuple_Check(state)) {
+        PyErr_SetString(PyExc_TypeError, "state argument must be a tuple");
+        return NULL;
+    }
+    if (!PyArg_ParseTuple(state, "O!i;setstate(): illegal state argument",
+                          &PyBytes_Type, &buffer, &flag))
+    {
+        return NULL;
+    }
+    if (PyBytes_GET_SIZE(buffer) > 0)
+        Py_XSETREF(self->pending, Py_NewRef(buffer));
+    else
+        Py_CLEAR(self->pending);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_io._FastDecoder.reset
+[clinic start generated code]*/
+
+static PyObject *
+_io__FastDecoder_reset_impl(fastdecoder_object *self)
+/*[clinic end generated code: output=35e17004aaf18e64 input=a06e8ddc1a802e3a]*/
+{
+    Py_CLEAR(self->pending);
+    Py_RETURN_NONE;
+}
+
+
 /* IncrementalNewlineDecoder */
 
 typedef struct {
@@ -298,7 +508,10 @@ _PyIncrementalNewlineDecoder_decode(PyObject *myself,
     CHECK_INITIALIZED_DECODER(self);
 
     /* decode input (with the eventual \r from a previous pass) */
-    if (self->decoder != Py_None) {
+    if (FastDecoder_Check(self->decoder)) {
+        output = _PyFastDecoder_decode(self->decoder, input, final);
+    }
+    else if (self->decoder != Py_None) {
         output = PyObject_CallMethodObjArgs(self->decoder,
             &_Py_ID(decode), input, final ? Py_True : Py_False, NULL);
     }
@@ -664,7 +877,9 @@ typedef struct
     PyObject *decoded_chars;       /* buffer for text returned from decoder */
     Py_ssize_t decoded_chars_used; /* offset into _decoded_chars for read() */
     PyObject *pending_bytes;       // data waiting to be written.
-                                   // ascii unicode, bytes, or list of them.
+                                   // bytes, unicode whose encoded form is
+                                   // its ascii data or cached utf-8,
+                                   // or list of them.
     Py_ssize_t pending_bytes_count;
 
     /* snapshot is either NULL, or a tuple (dec_flags, next_input) where
@@ -867,9 +1082,27 @@ _textiowrapper_set_decoder(textio *self, PyObject *codec_info,
         return 0;
 
     Py_CLEAR(self->decoder);
-    self->decoder = _PyCodecInfo_GetIncrementalDecoder(codec_info, errors);
-    if (self->decoder == NULL)
+    /* Decode the common codecs without their Python incremental decoder */
+    if (_PyObject_LookupAttr(codec_info, &_Py_ID(name), &res) < 0) {
         return -1;
+    }
+    if (res != NULL && PyUnicode_Check(res)) {
+        self->decoder = _PyFastDecoder_New(find_io_state_by_def(Py_TYPE(self)),
+                                           res, errors);
+        Py_DECREF(res);
+        if (self->decoder == NULL)
+            return -1;
+        if (self->decoder == Py_None)
+            Py_CLEAR(self->decoder);
+    }
+    else {
+        Py_XDECREF(res);
+    }
+    if (self->decoder == NULL) {
+        self->decoder = _PyCodecInfo_GetIncrementalDecoder(codec_info, errors);
+        if (self->decoder == NULL)
+            return -1;
+    }
 
     if (self->readuniversal) {
         PyObject *incrementalDecoder = PyObject_CallFunctionObjArgs(
@@ -890,6 +1123,8 @@ _textiowrapper_decode(PyObject *decoder, PyObject *bytes, int eof)
 
     if (Py_IS_TYPE(decoder, &PyIncrementalNewlineDecoder_Type))
         chars = _PyIncrementalNewlineDecoder_decode(decoder, bytes, eof);
+    else if (FastDecoder_Check(decoder))
+        chars = _PyFastDecoder_decode(decoder, bytes, eof);
     else
         chars = PyObject_CallMethodObjArgs(decoder, &_Py_ID(decode), bytes,
                                            eof ? Py_True : Py_False, NULL);
@@ -1515,10 +1750,11 @@ _textiowrapper_writeflush(textio *self)
         b = Py_NewRef(pending);
     }
     else if (PyUnicode_Check(pending)) {
-        assert(PyUnicode_IS_ASCII(pending));
-        assert(PyUnicode_GET_LENGTH(pending) == self->pending_bytes_count);
-        b = PyBytes_FromStringAndSize(
-                PyUnicode_DATA(pending), PyUnicode_GET_LENGTH(pending));
+        Py_ssize_t len;
+        const char *src = _PyUnicode_GetCachedUTF8(pending, &len);
+        assert(src != NULL);
+        assert(len == self->pending_bytes_count);
+        b = PyBytes_FromStringAndSize(src, len);
         if (b == NULL) {
             return -1;
         }
@@ -1538,9 +1774,8 @@ _textiowrapper_writeflush(textio *self)
             char *src;
             Py_ssize_t len;
             if (PyUnicode_Check(obj)) {
-                assert(PyUnicode_IS_ASCII(obj));
-                src = PyUnicode_DATA(obj);
-                len = PyUnicode_GET_LENGTH(obj);
+                src = (char *)_PyUnicode_GetCachedUTF8(obj, &len);
+                assert(src != NULL);
             }
             else {
                 assert(PyBytes_Check(obj));
@@ -1622,12 +1857,22 @@ _io_TextIOWrapper_write_impl(textio *self, PyObject *text)
         needflush = 1;
 
     /* XXX What if we were just reading? */
+    Py_ssize_t bytes_len;
     if (self->encodefunc != NULL) {
         if (PyUnicode_IS_ASCII(text) &&
                 // See bpo-43260
                 PyUnicode_GET_LENGTH(text) <= self->chunk_size &&
                 is_asciicompat_encoding(self->encodefunc)) {
             b = Py_NewRef(text);
+            bytes_len = PyUnicode_GET_LENGTH(text);
+        }
+        else if (self->encodefunc == (encodefunc_t) utf8_encode &&
+                 _PyUnicode_GetCachedUTF8(text, &bytes_len) != NULL &&
+                 bytes_len <= self->chunk_size) {
+            // The string already carries its UTF-8 representation:
+            // keep the str and copy that directly when flushing instead
+            // of encoding it into an intermediate bytes object.
+            b = Py_NewRef(text);
         }
         else {
             b = (*self->encodefunc)((PyObject *) self, text);
@@ -1649,11 +1894,7 @@ _io_TextIOWrapper_write_impl(textio *self, PyObject *text)
         return NULL;
     }
 
-    Py_ssize_t bytes_len;
-    if (b == text) {
-        bytes_len = PyUnicode_GET_LENGTH(b);
-    }
-    else {
+    if (b != text) {
         bytes_len = PyBytes_GET_SIZE(b);
     }
 
@@ -1916,6 +2157,8 @@ _io_TextIOWrapper_read_impl(textio *self, Py_ssize_t n)
         if (Py_IS_TYPE(self->decoder, &PyIncrementalNewlineDecoder_Type))
             decoded = _PyIncrementalNewlineDecoder_decode(self->decoder,
                                                           bytes, 1);
+        else if (FastDecoder_Check(self->decoder))
+            decoded = _PyFastDecoder_decode(self->decoder, bytes, 1);
         else
             decoded = PyObject_CallMethodObjArgs(
                 self->decoder, &_Py_ID(decode), bytes, Py_True, NULL);
@@ -3159,6 +3402,28 @@ textiowrapper_chunk_size_set(textio *self, PyObject *arg, void *context)
 #include "clinic/textio.c.h"
 #undef clinic_state
 
+static PyMethodDef fastdecoder_methods[] = {
+    _IO__FASTDECODER_DECODE_METHODDEF
+    _IO__FASTDECODER_GETSTATE_METHODDEF
+    _IO__FASTDECODER_SETSTATE_METHODDEF
+    _IO__FASTDECODER_RESET_METHODDEF
+    {NULL}
+};
+
+static PyType_Slot fastdecoder_slots[] = {
+    {Py_tp_dealloc, fastdecoder_dealloc},
+    {Py_tp_methods, fastdecoder_methods},
+    {0, NULL},
+};
+
+PyType_Spec fastdecoder_spec = {
+    .name = "_io._FastDecoder",
+    .basicsize = sizeof(fastdecoder_object),
+    .flags = (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE |
+              Py_TPFLAGS_DISALLOW_INSTANTIATION),
+    .slots = fastdecoder_slots,
+};
+
 static PyMethodDef incrementalnewlinedecoder_methods[] = {
     _IO_INCREMENTALNEWLINEDECODER_DECODE_METHODDEF
     _IO_INCREMENTALNEWLINEDECODER_GETSTATE_METHODDEF
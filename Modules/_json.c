@@ -45,12 +45,16 @@ typedef struct _PyEncoderObject {
     PyObject *indent;
     PyObject *key_separator;
     PyObject *item_separator;
+    PyObject *key_memo;
     char sort_keys;
     char skipkeys;
     int allow_nan;
     PyCFunction fast_encode;
 } PyEncoderObject;
 
+/* Maximum number of escaped keys remembered by an encoder */
+#define ENCODER_KEY_MEMO_SIZE 1024
+
 static PyMemberDef encoder_members[] = {
     {"markers", T_OBJECT, offsetof(PyEncoderObject, markers), READONLY, "markers"},
     {"default", T_OBJECT, offsetof(PyEncoderObject, defaultfn), READONLY, "default"},
@@ -302,6 +306,27 @@ escape_unicode(PyObject *pystr)
     return rval;
 }
 
+/* Return the number of characters in the UTF-8 encoded s[:end] */
+static Py_ssize_t
+utf8_char_index(PyObject *s, Py_ssize_t end)
+{
+    const unsigned char *p = (const unsigned char *)PyBytes_AS_STRING(s);
+    Py_ssize_t i, n = 0;
+
+    for (i = 0; i < end; i++) {
+        n += (p[i] & 0xC0) != 0x80;
+    }
+    return n;
+}
+
+/* Decode the UTF-8 document s as json.loads() does before parsing str */
+static PyObject *
+decode_utf8_document(PyObject *s)
+{
+    return PyUnicode_DecodeUTF8(PyBytes_AS_STRING(s), PyBytes_GET_SIZE(s),
+                                "surrogatepass");
+}
+
 static void
 raise_errmsg(const char *msg, PyObject *s, Py_ssize_t end)
 {
@@ -314,7 +339,22 @@ raise_errmsg(const char *msg, PyObject *s, Py_ssize_t end)
     }
 
     PyObject *exc;
-    exc = PyObject_CallFunction(JSONDecodeError, "zOn", msg, s, end);
+    if (PyBytes_Check(s)) {
+        /* Report the error as if the document had been decoded first.  If
+           it isn't valid UTF-8, this raises the UnicodeDecodeError that the
+           decoding would have raised. */
+        PyObject *doc = decode_utf8_document(s);
+        if (doc == NULL) {
+            Py_DECREF(JSONDecodeError);
+            return;
+        }
+        exc = PyObject_CallFunction(JSONDecodeError, "zOn", msg, doc,
+                                    utf8_char_index(s, end));
+        Py_DECREF(doc);
+    }
+    else {
+        exc = PyObject_CallFunction(JSONDecodeError, "zOn", msg, s, end);
+    }
     Py_DECREF(JSONDecodeError);
     if (exc) {
         PyErr_SetObject(JSONDecodeError, exc);
@@ -359,6 +399,92 @@ _build_rval_index_tuple(PyObject *rval, Py_ssize_t idx) {
     return tpl;
 }
 
+/* Get the characters of the document pystr.  Besides str, the scanner
+   accepts UTF-8 encoded bytes: all the JSON syntax is ASCII, so they can be
+   read as 1-byte characters, and only the contents of strings need to be
+   decoded. */
+static int
+scanner_input(PyObject *pystr, const void **data, int *kind, Py_ssize_t *len)
+{
+    if (PyBytes_Check(pystr)) {
+        *data = PyBytes_AS_STRING(pystr);
+        *kind = PyUnicode_1BYTE_KIND;
+        *len = PyBytes_GET_SIZE(pystr);
+        return 0;
+    }
+    if (PyUnicode_READY(pystr) == -1)
+        return -1;
+    *data = PyUnicode_DATA(pystr);
+    *kind = PyUnicode_KIND(pystr);
+    *len = PyUnicode_GET_LENGTH(pystr);
+    return 0;
+}
+
+/* Decode the UTF-8 bytes buf[start:end] of the bytes document pystr */
+static PyObject *
+decode_utf8_substring(PyObject *pystr, const void *buf,
+                      Py_ssize_t start, Py_ssize_t end, int ascii)
+{
+    const char *p = (const char *)buf + start;
+    PyObject *res;
+
+    if (ascii) {
+        /* No need to validate the data or to compute the maximum
+           character */
+        res = PyUnicode_New(end - start, 127);
+        if (res != NULL) {
+            memcpy(PyUnicode_DATA(res), p, end - start);
+        }
+        return res;
+    }
+    res = PyUnicode_DecodeUTF8(p, end - start, "surrogatepass");
+    if (res == NULL && PyErr_ExceptionMatches(PyExc_UnicodeDecodeError)) {
+        /* Raise the error with its position in the whole document */
+        PyErr_Clear();
+        res = decode_utf8_document(pystr);
+        if (res != NULL) {
+            Py_SETREF(res, NULL);
+            PyErr_SetString(PyExc_SystemError,
+                            "inconsistent UTF-8 decoding error");
+        }
+    }
+    return res;
+}
+
+/* Mask with the high bit of each byte of a size_t set */
+#define UCS1_ONES ((size_t)-1 / 0xFF)
+#define UCS1_HIGH_BITS (UCS1_ONES * 0x80)
+/* Does the size_t w contain a byte lower than n (n <= 0x80)? */
+#define UCS1_HAS_LESS(w, n) \
+    ((((w) - UCS1_ONES * (n)) & ~(w) & UCS1_HIGH_BITS) != 0)
+#define UCS1_HAS_BYTE(w, c) UCS1_HAS_LESS((w) ^ (UCS1_ONES * (c)), 1)
+
+/* Skip the 1-byte characters of a string which need no processing, a word
+   at a time.  Return the index of the first word containing a quote, a
+   backslash or a control character.  *maxchar is or-ed with the skipped
+   characters. */
+static Py_ssize_t
+skip_plain_ucs1(const Py_UCS1 *p, Py_ssize_t start, Py_ssize_t len,
+                Py_UCS4 *maxchar)
+{
+    size_t seen = 0;
+
+    while (len - start >= (Py_ssize_t)SIZEOF_SIZE_T) {
+        size_t w;
+        memcpy(&w, p + start, SIZEOF_SIZE_T);
+        if (UCS1_HAS_LESS(w, 0x20) || UCS1_HAS_BYTE(w, '"') ||
+            UCS1_HAS_BYTE(w, '\\')) {
+            break;
+        }
+        seen |= w;
+        start += SIZEOF_SIZE_T;
+    }
+    if (seen & UCS1_HIGH_BITS) {
+        *maxchar |= 0x80;
+    }
+    return start;
+}
+
 static PyObject *
 scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next_end_ptr)
 {
@@ -376,18 +502,15 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
     Py_ssize_t next /* = begin */;
     const void *buf;
     int kind;
+    int is_bytes = PyBytes_Check(pystr);
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (scanner_input(pystr, &buf, &kind, &len) < 0)
         return 0;
 
     _PyUnicodeWriter writer;
     _PyUnicodeWriter_Init(&writer);
     writer.overallocate = 1;
 
-    len = PyUnicode_GET_LENGTH(pystr);
-    buf = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-
     if (end < 0 || len < end) {
         PyErr_SetString(PyExc_ValueError, "end is out of bounds");
         goto bail;
@@ -395,10 +518,15 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
     while (1) {
         /* Find the end of the string or the next escape */
         Py_UCS4 c;
+        Py_UCS4 maxchar = 0;
         {
             // Use tight scope variable to help register allocation.
             Py_UCS4 d = 0;
-            for (next = end; next < len; next++) {
+            next = end;
+            if (kind == PyUnicode_1BYTE_KIND) {
+                next = skip_plain_ucs1(buf, end, len, &maxchar);
+            }
+            for (; next < len; next++) {
                 d = PyUnicode_READ(kind, buf, next);
                 if (d == '"' || d == '\\') {
                     break;
@@ -407,6 +535,7 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
                     raise_errmsg("Invalid control character at", pystr, next);
                     goto bail;
                 }
+                maxchar |= d;
             }
             c = d;
         }
@@ -414,7 +543,14 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
         if (c == '"') {
             // Fast path for simple case.
             if (writer.buffer == NULL) {
-                PyObject *ret = PyUnicode_Substring(pystr, end, next);
+                PyObject *ret;
+                if (is_bytes) {
+                    ret = decode_utf8_substring(pystr, buf, end, next,
+                                                maxchar < 0x80);
+                }
+                else {
+                    ret = PyUnicode_Substring(pystr, end, next);
+                }
                 if (ret == NULL) {
                     goto bail;
                 }
@@ -429,8 +565,27 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
 
         /* Pick up this chunk if it's not zero length */
         if (next != end) {
-            if (_PyUnicodeWriter_WriteSubstring(&writer, pystr, end, next) < 0) {
-                goto bail;
+            if (!is_bytes) {
+                if (_PyUnicodeWriter_WriteSubstring(&writer, pystr, end, next) < 0) {
+                    goto bail;
+                }
+            }
+            else if (maxchar < 0x80) {
+                if (_PyUnicodeWriter_WriteASCIIString(
+                        &writer, (const char *)buf + end, next - end) < 0) {
+                    goto bail;
+                }
+            }
+            else {
+                PyObject *chunk = decode_utf8_substring(pystr, buf, end, next, 0);
+                if (chunk == NULL) {
+                    goto bail;
+                }
+                if (_PyUnicodeWriter_WriteStr(&writer, chunk) < 0) {
+                    Py_DECREF(chunk);
+                    goto bail;
+                }
+                Py_DECREF(chunk);
             }
         }
         next++;
@@ -675,12 +830,9 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     int has_pairs_hook = (s->object_pairs_hook != Py_None);
     Py_ssize_t next_idx;
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (scanner_input(pystr, &str, &kind, &end_idx) < 0)
         return NULL;
-
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
+    end_idx--;
 
     if (has_pairs_hook)
         rval = PyList_New(0);
@@ -801,17 +953,14 @@ _parse_array_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssi
     PyObject *rval;
     Py_ssize_t next_idx;
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (scanner_input(pystr, &str, &kind, &end_idx) < 0)
         return NULL;
+    end_idx--;
 
     rval = PyList_New(0);
     if (rval == NULL)
         return NULL;
 
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
-
     /* skip whitespace after [ */
     while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
 
@@ -906,12 +1055,9 @@ _match_number_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t start, Py_
     PyObject *numstr = NULL;
     PyObject *custom_func;
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (scanner_input(pystr, &str, &kind, &end_idx) < 0)
         return NULL;
-
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
+    end_idx--;
 
     /* read a sign if it's there, make sure it's not the end of the string */
     if (PyUnicode_READ(kind, str, idx) == '-') {
@@ -1018,13 +1164,9 @@ scan_once_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssize_
     int kind;
     Py_ssize_t length;
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (scanner_input(pystr, &str, &kind, &length) < 0)
         return NULL;
 
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    length = PyUnicode_GET_LENGTH(pystr);
-
     if (idx < 0) {
         PyErr_SetString(PyExc_ValueError, "idx cannot be negative");
         return NULL;
@@ -1127,7 +1269,8 @@ scanner_call(PyScannerObject *self, PyObject *args, PyObject *kwds)
     if (!PyArg_ParseTupleAndKeywords(args, kwds, "On:scan_once", kwlist, &pystr, &idx))
         return NULL;
 
-    if (PyUnicode_Check(pystr)) {
+    if (PyUnicode_Check(pystr) || PyBytes_Check(pystr)) {
+        /* For bytes, indices are byte offsets */
         rval = scan_once_unicode(self, pystr, idx, &next_idx);
     }
     else {
@@ -1251,6 +1394,11 @@ encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
     s->skipkeys = skipkeys;
     s->allow_nan = allow_nan;
     s->fast_encode = NULL;
+    s->key_memo = PyDict_New();
+    if (s->key_memo == NULL) {
+        Py_DECREF(s);
+        return NULL;
+    }
 
     if (PyCFunction_Check(s->encoder)) {
         PyCFunction f = PyCFunction_GetFunction(s->encoder);
@@ -1473,7 +1621,28 @@ encoder_encode_key_value(PyEncoderObject *s, _PyUnicodeWriter *writer, bool *fir
     PyObject *keystr = NULL;
     PyObject *encoded;
 
-    if (PyUnicode_Check(key)) {
+    if (PyUnicode_CheckExact(key)) {
+        /* Dicts of the same shape repeat their keys: reuse the escaped
+           key followed by the key separator. */
+        encoded = PyDict_GetItemWithError(s->key_memo, key);
+        if (encoded != NULL) {
+            if (*first) {
+                *first = false;
+            }
+            else if (_PyUnicodeWriter_WriteStr(writer, s->item_separator) < 0) {
+                return -1;
+            }
+            if (_PyUnicodeWriter_WriteStr(writer, encoded) < 0) {
+                return -1;
+            }
+            return encoder_listencode_obj(s, writer, value, indent_level);
+        }
+        if (PyErr_Occurred()) {
+            return -1;
+        }
+        keystr = Py_NewRef(key);
+    }
+    else if (PyUnicode_Check(key)) {
         keystr = Py_NewRef(key);
     }
     else if (PyFloat_Check(key)) {
@@ -1512,16 +1681,33 @@ encoder_encode_key_value(PyEncoderObject *s, _PyUnicodeWriter *writer, bool *fir
     }
 
     encoded = encoder_encode_string(s, keystr);
-    Py_DECREF(keystr);
     if (encoded == NULL) {
+        Py_DECREF(keystr);
         return -1;
     }
 
-    if (_steal_accumulate(writer, encoded) < 0) {
-        return -1;
+    if (keystr == key && PyUnicode_CheckExact(key) &&
+            PyDict_GET_SIZE(s->key_memo) < ENCODER_KEY_MEMO_SIZE) {
+        Py_SETREF(encoded, PyUnicode_Concat(encoded, s->key_separator));
+        if (encoded == NULL ||
+                PyDict_SetItem(s->key_memo, key, encoded) < 0) {
+            Py_XDECREF(encoded);
+            Py_DECREF(keystr);
+            return -1;
+        }
+        Py_DECREF(keystr);
+        if (_steal_accumulate(writer, encoded) < 0) {
+            return -1;
+        }
     }
-    if (_PyUnicodeWriter_WriteStr(writer, s->key_separator) < 0) {
-        return -1;
+    else {
+        Py_DECREF(keystr);
+        if (_steal_accumulate(writer, encoded) < 0) {
+            return -1;
+        }
+        if (_PyUnicodeWriter_WriteStr(writer, s->key_separator) < 0) {
+            return -1;
+        }
     }
     if (encoder_listencode_obj(s, writer, value, indent_level) < 0) {
         return -1;
@@ -1717,6 +1903,7 @@ encoder_traverse(PyEncoderObject *self, visitproc visit, void *arg)
     Py_VISIT(self->indent);
     Py_VISIT(self->key_separator);
     Py_VISIT(self->item_separator);
+    Py_VISIT(self->key_memo);
     return 0;
 }
 
@@ -1730,6 +1917,7 @@ encoder_clear(PyEncoderObject *self)
     Py_CLEAR(self->indent);
     Py_CLEAR(self->key_separator);
     Py_CLEAR(self->item_separator);
+    Py_CLEAR(self->key_memo);
     return 0;
 }
 
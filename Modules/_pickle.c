@@ -846,6 +846,16 @@ PyMemoTable_Del(PyMemoTable *self)
     PyMem_Free(self);
 }
 
+/* The allocator aligns objects on 16 bytes: rotate the always-zero low
+   bits away so that every slot of the table can be used (this is
+   _Py_HashPointerRaw(), inlined). */
+static inline size_t
+_PyMemoTable_Hash(PyObject *key)
+{
+    size_t y = (size_t)key;
+    return (y >> 4) | (y << (8 * SIZEOF_VOID_P - 4));
+}
+
 /* Since entries cannot be deleted from this hashtable, _PyMemoTable_Lookup()
    can be considerably simpler than dictobject.c's lookdict(). */
 static PyMemoEntry *
@@ -856,7 +866,7 @@ _PyMemoTable_Lookup(PyMemoTable *self, PyObject *key)
     size_t mask = self->mt_mask;
     PyMemoEntry *table = self->mt_table;
     PyMemoEntry *entry;
-    Py_hash_t hash = (Py_hash_t)key >> 3;
+    size_t hash = _PyMemoTable_Hash(key);
 
     i = hash & mask;
     entry = &table[i];
@@ -1731,20 +1741,14 @@ _Unpickler_SetBuffers(UnpicklerObject *self, PyObject *buffers)
     return 0;
 }
 
-/* Generate a GET opcode for an object stored in the memo. */
+/* Generate a GET opcode for the memo entry whose value was already looked
+   up. */
 static int
-memo_get(PickleState *st, PicklerObject *self, PyObject *key)
+memo_write_get(PickleState *st, PicklerObject *self, Py_ssize_t *value)
 {
-    Py_ssize_t *value;
     char pdata[30];
     Py_ssize_t len;
 
-    value = PyMemoTable_Get(self->memo, key);
-    if (value == NULL)  {
-        PyErr_SetObject(PyExc_KeyError, key);
-        return -1;
-    }
-
     if (!self->bin) {
         pdata[0] = GET;
         PyOS_snprintf(pdata + 1, sizeof(pdata) - 1,
@@ -1778,6 +1782,20 @@ memo_get(PickleState *st, PicklerObject *self, PyObject *key)
     return 0;
 }
 
+/* Generate a GET opcode for an object stored in the memo. */
+static int
+memo_get(PickleState *st, PicklerObject *self, PyObject *key)
+{
+    Py_ssize_t *value;
+
+    value = PyMemoTable_Get(self->memo, key);
+    if (value == NULL)  {
+        PyErr_SetObject(PyExc_KeyError, key);
+        return -1;
+    }
+    return memo_write_get(st, self, value);
+}
+
 /* Store an object in the memo, assign it a new unique ID based on the number
    of objects currently stored in the memo and generate a PUT opcode. */
 static int
@@ -4327,8 +4345,9 @@ save(PickleState *st, PicklerObject *self, PyObject *obj, int pers_save)
     /* Check the memo to see if it has the object. If so, generate
        a GET (or BINGET) opcode, instead of pickling the object
        once again. */
-    if (PyMemoTable_Get(self->memo, obj)) {
-        return memo_get(st, self, obj);
+    Py_ssize_t *memo_value = PyMemoTable_Get(self->memo, obj);
+    if (memo_value != NULL) {
+        return memo_write_get(st, self, memo_value);
     }
 
     if (type == &PyBytes_Type) {
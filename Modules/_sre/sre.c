@@ -41,8 +41,10 @@ static const char copyright[] =
 #define PY_SSIZE_T_CLEAN
 
 #include "Python.h"
+#include "pycore_bytesobject.h"   // _PyBytes_Find()
 #include "pycore_long.h"          // _PyLong_GetZero()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
+#include "pycore_runtime.h"       // _PyRuntime
 #include "structmember.h"         // PyMemberDef
 
 #include "sre.h"
@@ -187,11 +189,31 @@ char_loc_ignore(SRE_CODE pattern, SRE_CODE ch)
 
 /* helpers */
 
+/* The engine runs without the GIL on exact str and bytes subjects of
+   at least this many characters, so that threads can search in
+   parallel.  It must then only use the raw memory allocator. */
+#define SRE_ALLOW_THREADS_MINSIZE 8192
+
+static int
+sre_check_signals(SRE_STATE* state)
+{
+    int res;
+
+    if (state->tstate == NULL)
+        return PyErr_CheckSignals();
+    if (!_Py_atomic_load_relaxed(&_PyRuntime.signals.is_tripped))
+        return 0;
+    PyEval_RestoreThread(state->tstate);
+    res = PyErr_CheckSignals();
+    state->tstate = PyEval_SaveThread();
+    return res;
+}
+
 static void
 data_stack_dealloc(SRE_STATE* state)
 {
     if (state->data_stack) {
-        PyMem_Free(state->data_stack);
+        PyMem_RawFree(state->data_stack);
         state->data_stack = NULL;
     }
     state->data_stack_size = state->data_stack_base = 0;
@@ -207,7 +229,7 @@ data_stack_grow(SRE_STATE* state, Py_ssize_t size)
         void* stack;
         cursize = minsize+minsize/4+1024;
         TRACE(("allocate/grow stack %zd\n", cursize));
-        stack = PyMem_Realloc(state->data_stack, cursize);
+        stack = PyMem_RawRealloc(state->data_stack, cursize);
         if (!stack) {
             data_stack_dealloc(state);
             return SRE_ERROR_MEMORY;
@@ -459,6 +481,12 @@ state_init(SRE_STATE* state, PatternObject* pattern, PyObject* string,
     state->start = (void*) ((char*) ptr + start * state->charsize);
     state->end = (void*) ((char*) ptr + end * state->charsize);
 
+    state->required = pattern->required;
+    state->required_pos = -1;
+    state->allow_threads = ((PyBytes_CheckExact(string) ||
+                             PyUnicode_CheckExact(string)) &&
+                            end - start >= SRE_ALLOW_THREADS_MINSIZE);
+
     state->string = Py_NewRef(string);
     state->pos = start;
     state->endpos = end;
@@ -571,6 +599,7 @@ pattern_traverse(PatternObject *self, visitproc visit, void *arg)
     Py_VISIT(self->groupindex);
     Py_VISIT(self->indexgroup);
     Py_VISIT(self->pattern);
+    Py_VISIT(self->required);
     return 0;
 }
 
@@ -580,6 +609,7 @@ pattern_clear(PatternObject *self)
     Py_CLEAR(self->groupindex);
     Py_CLEAR(self->indexgroup);
     Py_CLEAR(self->pattern);
+    Py_CLEAR(self->required);
     return 0;
 }
 
@@ -597,26 +627,99 @@ pattern_dealloc(PatternObject* self)
     Py_DECREF(tp);
 }
 
+/* Release the GIL on large immutable subjects, unless the previous match
+   on this state ended close to where the scan started, as happens when
+   findall() or sub() walk through many short matches: switching threads
+   would then cost more than the matching itself. */
+LOCAL(void)
+sre_begin_allow_threads(SRE_STATE* state)
+{
+    if (state->allow_threads && !state->ended_near_start)
+        state->tstate = PyEval_SaveThread();
+}
+
+LOCAL(void)
+sre_end_allow_threads(SRE_STATE* state, const void* start, Py_ssize_t status)
+{
+    if (state->tstate != NULL) {
+        PyEval_RestoreThread(state->tstate);
+        state->tstate = NULL;
+    }
+    state->ended_near_start = (status > 0 &&
+        (char*)state->ptr - (char*)start <
+            SRE_ALLOW_THREADS_MINSIZE * state->charsize);
+}
+
 LOCAL(Py_ssize_t)
 sre_match(SRE_STATE* state, SRE_CODE* pattern)
 {
+    const void* start = state->start;
+    Py_ssize_t status;
+
+    sre_begin_allow_threads(state);
     if (state->charsize == 1)
-        return sre_ucs1_match(state, pattern, 1);
-    if (state->charsize == 2)
-        return sre_ucs2_match(state, pattern, 1);
-    assert(state->charsize == 4);
-    return sre_ucs4_match(state, pattern, 1);
+        status = sre_ucs1_match(state, pattern, 1);
+    else if (state->charsize == 2)
+        status = sre_ucs2_match(state, pattern, 1);
+    else {
+        assert(state->charsize == 4);
+        status = sre_ucs4_match(state, pattern, 1);
+    }
+    sre_end_allow_threads(state, start, status);
+    return status;
+}
+
+/* Return 0 if the rest of the slice does not contain the literal that
+   every match of the pattern must contain, 1 otherwise.  The position
+   found is remembered, so repeated searches scan the subject once. */
+LOCAL(int)
+sre_has_required(SRE_STATE* state)
+{
+    PyObject *required = state->required;
+    Py_ssize_t start, end, pos;
+
+    start = ((char*)state->start - (char*)state->beginning) / state->charsize;
+    if (state->required_pos >= start)
+        return 1;
+    end = ((char*)state->end - (char*)state->beginning) / state->charsize;
+    if (state->isbytes) {
+        pos = _PyBytes_Find((const char*)state->start, end - start,
+                            PyBytes_AS_STRING(required),
+                            PyBytes_GET_SIZE(required), start);
+    }
+    else {
+        pos = PyUnicode_Find(state->string, required, start, end, 1);
+        if (pos == -2) {
+            /* let the search itself decide */
+            PyErr_Clear();
+            return 1;
+        }
+    }
+    if (pos < 0)
+        return 0;
+    state->required_pos = pos;
+    return 1;
 }
 
 LOCAL(Py_ssize_t)
 sre_search(SRE_STATE* state, SRE_CODE* pattern)
 {
+    const void* start = state->start;
+    Py_ssize_t status;
+
+    if (state->required != NULL && !sre_has_required(state))
+        return 0;
+    sre_begin_allow_threads(state);
     if (state->charsize == 1)
-        return sre_ucs1_search(state, pattern);
-    if (state->charsize == 2)
-        return sre_ucs2_search(state, pattern);
-    assert(state->charsize == 4);
-    return sre_ucs4_search(state, pattern);
+        status = sre_ucs1_search(state, pattern);
+    else if (state->charsize == 2)
+        status = sre_ucs2_search(state, pattern);
+    else {
+        assert(state->charsize == 4);
+        status = sre_ucs4_search(state, pattern);
+    }
+    sre_end_allow_threads(state, start, status);
+    return status;
 }
 
 /*[clinic input]
@@ -1432,14 +1535,15 @@ _sre.compile
     groups: Py_ssize_t
     groupindex: object(subclass_of='&PyDict_Type')
     indexgroup: object(subclass_of='&PyTuple_Type')
+    required: object = None
 
 [clinic start generated code]*/
 
 static PyObject *
 _sre_compile_impl(PyObject *module, PyObject *pattern, int flags,
                   PyObject *code, Py_ssize_t groups, PyObject *groupindex,
-                  PyObject *indexgroup)
-/*[clinic end generated code: output=ef9c2b3693776404 input=0a68476dbbe5db30]*/
+                  PyObject *indexgroup, PyObject *required)
+/*[clinic end generated code: output=fe42bc8e59cf149c input=4a18b908fcb10724]*/
 {
     /* "compile" pattern descriptor to pattern object */
 
@@ -1456,6 +1560,7 @@ _sre_compile_impl(PyObject *module, PyObject *pattern, int flags,
     self->pattern = NULL;
     self->groupindex = NULL;
     self->indexgroup = NULL;
+    self->required = NULL;
 
     self->codesize = n;
 
@@ -1506,6 +1611,21 @@ _sre_compile_impl(PyObject *module, PyObject *pattern, int flags,
         }
     }
 
+    if (required != Py_None) {
+        if (self->isbytes > 0 ? !PyBytes_CheckExact(required)
+                              : (self->isbytes < 0 ||
+                                 !PyUnicode_CheckExact(required)))
+        {
+            PyErr_SetString(PyExc_TypeError,
+                            "required literal must match the pattern type");
+            Py_DECREF(self);
+            return NULL;
+        }
+        if (PyObject_Length(required) > 0) {
+            self->required = Py_NewRef(required);
+        }
+    }
+
     if (!_validate(self)) {
         Py_DECREF(self);
         return NULL;
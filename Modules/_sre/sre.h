@@ -34,6 +34,7 @@ typedef struct {
     int flags; /* flags used when compiling pattern source */
     PyObject *weakreflist; /* List of weak references */
     int isbytes; /* pattern type (1 - bytes, 0 - string, -1 - None) */
+    PyObject *required; /* literal every match contains (or NULL) */
     /* pattern code */
     Py_ssize_t codesize;
     SRE_CODE code[1];
@@ -84,6 +85,13 @@ typedef struct {
     int charsize; /* character size */
     int match_all;
     int must_advance;
+    /* literal every match contains, and where it was last found */
+    PyObject* required;
+    Py_ssize_t required_pos;
+    /* release the GIL while matching (see sre_begin_allow_threads) */
+    int allow_threads;
+    int ended_near_start;
+    PyThreadState* tstate; /* while the GIL is released (or NULL) */
     /* marks */
     int lastmark;
     int lastindex;
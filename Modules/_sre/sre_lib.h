@@ -226,8 +226,15 @@ SRE(count)(SRE_STATE* state, const SRE_CODE* pattern, Py_ssize_t maxcount)
     case SRE_OP_ANY:
         /* repeated dot wildcard. */
         TRACE(("|%p|%p|COUNT ANY\n", pattern, ptr));
+#if SIZEOF_SRE_CHAR == 1
+        {
+            const SRE_CHAR *p = memchr(ptr, '\n', end - ptr);
+            ptr = p ? p : end;
+        }
+#else
         while (ptr < end && !SRE_IS_LINEBREAK(*ptr))
             ptr++;
+#endif
         break;
 
     case SRE_OP_ANY_ALL:
@@ -285,8 +292,15 @@ SRE(count)(SRE_STATE* state, const SRE_CODE* pattern, Py_ssize_t maxcount)
             ptr = end; /* literal can't match: doesn't fit in char width */
         else
 #endif
+#if SIZEOF_SRE_CHAR == 1
+        {
+            const SRE_CHAR *p = memchr(ptr, c, end - ptr);
+            ptr = p ? p : end;
+        }
+#else
         while (ptr < end && *ptr != c)
             ptr++;
+#endif
         break;
 
     case SRE_OP_NOT_LITERAL_IGNORE:
@@ -333,6 +347,62 @@ SRE(count)(SRE_STATE* state, const SRE_CODE* pattern, Py_ssize_t maxcount)
     return ptr - (SRE_CHAR*) state->ptr;
 }
 
+/* Used by MIN_REPEAT_ONE when its tail starts with the literal chr:
+   return how many single-character items can be matched before the
+   next occurrence of chr, at most maxcount.  The positions skipped this
+   way are those where the tail cannot possibly match. */
+LOCAL(Py_ssize_t)
+SRE(count_to_literal)(SRE_STATE* state, const SRE_CODE* pattern,
+                      SRE_CODE chr, Py_ssize_t maxcount)
+{
+    const SRE_CHAR* start = (const SRE_CHAR *)state->ptr;
+    const SRE_CHAR* ptr = start;
+    const SRE_CHAR* end = (const SRE_CHAR *)state->end;
+    Py_ssize_t i;
+
+    if (maxcount < end - ptr && maxcount != SRE_MAXREPEAT)
+        end = ptr + maxcount;
+
+    switch (pattern[0]) {
+
+    case SRE_OP_ANY:
+    case SRE_OP_ANY_ALL:
+#if SIZEOF_SRE_CHAR == 1
+        if (chr < 256) {
+            const SRE_CHAR *p = memchr(ptr, (int)chr, end - ptr);
+            if (p != NULL)
+                end = p;
+            if (pattern[0] == SRE_OP_ANY) {
+                p = memchr(ptr, '\n', end - ptr);
+                if (p != NULL)
+                    end = p;
+            }
+            ptr = end;
+            break;
+        }
+#endif
+        while (ptr < end && (SRE_CODE) *ptr != chr &&
+               (pattern[0] == SRE_OP_ANY_ALL || !SRE_IS_LINEBREAK(*ptr)))
+            ptr++;
+        break;
+
+    default:
+        while (ptr < end && (SRE_CODE) *ptr != chr) {
+            state->ptr = ptr;
+            i = SRE(count)(state, pattern, 1);
+            if (i < 0)
+                return i;
+            if (!i)
+                break;
+            ptr++;
+        }
+        break;
+    }
+
+    state->ptr = start;
+    return ptr - start;
+}
+
 /* The macros below should be used to protect recursive SRE(match)()
  * calls that *failed* and do *not* return immediately (IOW, those
  * that will backtrack). Explaining:
@@ -526,7 +596,7 @@ typedef struct {
 
 #define MAYBE_CHECK_SIGNALS                                        \
     do {                                                           \
-        if ((0 == (++sigcount & 0xfff)) && PyErr_CheckSignals()) { \
+        if ((0 == (++sigcount & 0xfff)) && sre_check_signals(state)) { \
             RETURN_ERROR(SRE_ERROR_INTERRUPTED);                   \
         }                                                          \
     } while (0)
@@ -992,6 +1062,28 @@ SRE(match)(SRE_STATE* state, const SRE_CODE* pattern, int toplevel)
 
                 while ((Py_ssize_t)pattern[2] == SRE_MAXREPEAT
                        || ctx->count <= (Py_ssize_t)pattern[2]) {
+                    /* skip the group ends in "(.*?)x", they don't
+                       consume any characters */
+                    const SRE_CODE *tail = pattern + pattern[0];
+                    while (tail[0] == SRE_OP_MARK)
+                        tail += 2;
+                    if (tail[0] == SRE_OP_LITERAL) {
+                        /* tail starts with a literal.  skip positions
+                           where the rest of the pattern cannot possibly
+                           match, without trying the tail at each one */
+                        state->ptr = ptr;
+                        ret = SRE(count_to_literal)(state, pattern+3,
+                                tail[1],
+                                (Py_ssize_t)pattern[2] == SRE_MAXREPEAT ?
+                                    SRE_MAXREPEAT :
+                                    (Py_ssize_t)pattern[2] - ctx->count);
+                        RETURN_ON_ERROR(ret);
+                        DATA_LOOKUP_AT(SRE(match_context), ctx, ctx_pos);
+                        ptr += ret;
+                        ctx->count += ret;
+                        if (ptr >= end || (SRE_CODE) *ptr != tail[1])
+                            break;
+                    }
                     state->ptr = ptr;
                     DO_JUMP(JUMP_MIN_REPEAT_ONE,jump_min_repeat_one,
                             pattern+pattern[0]);
@@ -1085,10 +1177,11 @@ SRE(match)(SRE_STATE* state, const SRE_CODE* pattern, int toplevel)
             /* install new repeat context */
             /* TODO(https://github.com/python/cpython/issues/67877): Fix this
              * potential memory leak. */
-            ctx->u.rep = (SRE_REPEAT*) PyObject_Malloc(sizeof(*ctx->u.rep));
+            ctx->u.rep = (SRE_REPEAT*) (state->tstate != NULL
+                ? PyMem_RawMalloc(sizeof(*ctx->u.rep))
+                : PyObject_Malloc(sizeof(*ctx->u.rep)));
             if (!ctx->u.rep) {
-                PyErr_NoMemory();
-                RETURN_FAILURE;
+                RETURN_ERROR(SRE_ERROR_MEMORY);
             }
             ctx->u.rep->count = -1;
             ctx->u.rep->pattern = pattern;
@@ -1099,7 +1192,10 @@ SRE(match)(SRE_STATE* state, const SRE_CODE* pattern, int toplevel)
             state->ptr = ptr;
             DO_JUMP(JUMP_REPEAT, jump_repeat, pattern+pattern[0]);
             state->repeat = ctx->u.rep->prev;
-            PyObject_Free(ctx->u.rep);
+            if (state->tstate != NULL)
+                PyMem_RawFree(ctx->u.rep);
+            else
+                PyObject_Free(ctx->u.rep);
 
             if (ret) {
                 RETURN_ON_ERROR(ret);
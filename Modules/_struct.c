@@ -10,6 +10,7 @@
 #define PY_SSIZE_T_CLEAN
 
 #include "Python.h"
+#include "pycore_bitutils.h"      // _Py_bswap32()
 #include "pycore_moduleobject.h"  // _PyModule_GetState()
 #include "structmember.h"         // PyMemberDef
 #include <ctype.h>
@@ -1638,6 +1639,24 @@ s_dealloc(PyStructObject *s)
     Py_DECREF(tp);
 }
 
+/* Unpack the value of a format code stored at res */
+static inline PyObject *
+s_unpack_value(_structmodulestate *state, const formatcode *code,
+               const char *res)
+{
+    const formatdef *e = code->fmtdef;
+    if (e->format == 's') {
+        return PyBytes_FromStringAndSize(res, code->size);
+    } else if (e->format == 'p') {
+        Py_ssize_t n = *(unsigned char*)res;
+        if (n >= code->size)
+            n = code->size - 1;
+        return PyBytes_FromStringAndSize(res + 1, n);
+    } else {
+        return e->unpack(state, res, e);
+    }
+}
+
 static PyObject *
 s_unpack_internal(PyStructObject *soself, const char *startfrom,
                   _structmodulestate *state) {
@@ -1648,21 +1667,10 @@ s_unpack_internal(PyStructObject *soself, const char *startfrom,
         return NULL;
 
     for (code = soself->s_codes; code->fmtdef != NULL; code++) {
-        const formatdef *e = code->fmtdef;
         const char *res = startfrom + code->offset;
         Py_ssize_t j = code->repeat;
         while (j--) {
-            PyObject *v;
-            if (e->format == 's') {
-                v = PyBytes_FromStringAndSize(res, code->size);
-            } else if (e->format == 'p') {
-                Py_ssize_t n = *(unsigned char*)res;
-                if (n >= code->size)
-                    n = code->size - 1;
-                v = PyBytes_FromStringAndSize(res + 1, n);
-            } else {
-                v = e->unpack(state, res, e);
-            }
+            PyObject *v = s_unpack_value(state, code, res);
             if (v == NULL)
                 goto fail;
             PyTuple_SET_ITEM(result, i++, v);
@@ -1908,6 +1916,277 @@ Struct_iter_unpack(PyStructObject *self, PyObject *buffer)
 }
 
 
+/* Columnar unpacking and packing */
+
+/* Return the memoryview format character of a column of values of format e,
+   or 0 for 's' and 'p'.  *swap is set if the values are not stored in native
+   byte order. */
+static char
+column_format(const formatdef *e, int *swap)
+{
+    int std_signed = 1;
+
+    *swap = 0;
+    if (e->format == 's' || e->format == 'p') {
+        return 0;
+    }
+    if (e >= native_table && e < native_table + Py_ARRAY_LENGTH(native_table)) {
+        return e->format;
+    }
+#if PY_LITTLE_ENDIAN
+    *swap = (e >= bigendian_table
+             && e < bigendian_table + Py_ARRAY_LENGTH(bigendian_table));
+#else
+    *swap = (e >= lilendian_table
+             && e < lilendian_table + Py_ARRAY_LENGTH(lilendian_table));
+#endif
+    /* Standard sizes: pick the native type of the same size */
+    switch (e->format) {
+    case 'c': case 'b': case 'B': case '?': case 'e': case 'f': case 'd':
+        return e->format;
+    case 'H': case 'I': case 'L': case 'Q':
+        std_signed = 0;
+        break;
+    }
+    switch (e->size) {
+    case 2: return (sizeof(short) == 2) ? (std_signed ? 'h' : 'H') : 0;
+    case 4: return (sizeof(int) == 4) ? (std_signed ? 'i' : 'I') : 0;
+    case 8: return (sizeof(long long) == 8) ? (std_signed ? 'q' : 'Q') : 0;
+    }
+    return 0;
+}
+
+#define COPY_COLUMN(TYPE, CONVERT)                          \
+    for (i = 0; i < n; i++) {                               \
+        TYPE x;                                             \
+        memcpy(&x, src + i * sstride, sizeof(TYPE));        \
+        x = CONVERT(x);                                     \
+        memcpy(dst + i * dstride, &x, sizeof(TYPE));        \
+    }
+
+#define COPY_AS_IS(x) (x)
+#define COPY_AS_BOOL(x) ((x) != 0)
+
+/* Copy n values of size bytes, reversing their bytes if swap is set */
+static void
+copy_column(char *dst, Py_ssize_t dstride, const char *src,
+            Py_ssize_t sstride, Py_ssize_t n, Py_ssize_t size, int swap,
+            int is_bool)
+{
+    Py_ssize_t i;
+
+    if (is_bool) {
+        COPY_COLUMN(uint8_t, COPY_AS_BOOL)
+    }
+    else if (size == 1) {
+        COPY_COLUMN(uint8_t, COPY_AS_IS)
+    }
+    else if (size == 2) {
+        if (swap) {
+            COPY_COLUMN(uint16_t, _Py_bswap16)
+        }
+        else {
+            COPY_COLUMN(uint16_t, COPY_AS_IS)
+        }
+    }
+    else if (size == 4) {
+        if (swap) {
+            COPY_COLUMN(uint32_t, _Py_bswap32)
+        }
+        else {
+            COPY_COLUMN(uint32_t, COPY_AS_IS)
+        }
+    }
+    else if (size == 8) {
+        if (swap) {
+            COPY_COLUMN(uint64_t, _Py_bswap64)
+        }
+        else {
+            COPY_COLUMN(uint64_t, COPY_AS_IS)
+        }
+    }
+    else {
+        assert(!swap);
+        for (i = 0; i < n; i++) {
+            memcpy(dst + i * dstride, src + i * sstride, size);
+        }
+    }
+}
+
+#undef COPY_COLUMN
+#undef COPY_AS_IS
+#undef COPY_AS_BOOL
+
+/* Unpack the values of a format code stored every stride bytes from src */
+static PyObject *
+unpack_column(_structmodulestate *state, const formatcode *code,
+              const char *src, Py_ssize_t n, Py_ssize_t stride)
+{
+    const formatdef *e = code->fmtdef;
+    PyObject *bytes, *view, *result;
+    char format[2] = {0, 0};
+    int swap;
+    Py_ssize_t i;
+
+    format[0] = column_format(e, &swap);
+    if (format[0] == 0 || (e->format == '?' && e->size != 1)) {
+        result = PyList_New(n);
+        if (result == NULL) {
+            return NULL;
+        }
+        for (i = 0; i < n; i++) {
+            PyObject *v = s_unpack_value(state, code, src + i * stride);
+            if (v == NULL) {
+                Py_DECREF(result);
+                return NULL;
+            }
+            PyList_SET_ITEM(result, i, v);
+        }
+        return result;
+    }
+
+    bytes = PyBytes_FromStringAndSize(NULL, n * e->size);
+    if (bytes == NULL) {
+        return NULL;
+    }
+    copy_column(PyBytes_AS_STRING(bytes), e->size, src, stride, n, e->size,
+                swap, e->format == '?');
+    view = PyMemoryView_FromObject(bytes);
+    Py_DECREF(bytes);
+    if (view == NULL) {
+        return NULL;
+    }
+    result = PyObject_CallMethod(view, "cast", "s", format);
+    Py_DECREF(view);
+    return result;
+}
+
+/*[clinic input]
+Struct.unpack_columns
+
+    buffer: Py_buffer
+    /
+
+Return a tuple of columns unpacked from the given bytes.
+
+The bytes hold consecutive records, each of Struct.size bytes.  There is
+one column per value of the format: a memoryview holding the value of
+every record in the native type of the same size, or a list of bytes for
+'s' and 'p' values.
+
+Requires that the bytes length be a multiple of the struct size.
+[clinic start generated code]*/
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer)
+/*[clinic end generated code: output=248511f7e13c1dba input=2164827b219e10de]*/
+{
+    _structmodulestate *state = get_struct_state_structinst(self);
+    formatcode *code;
+    Py_ssize_t i = 0, n;
+    PyObject *result;
+
+    assert(self->s_codes != NULL);
+    if (self->s_size == 0) {
+        PyErr_Format(state->StructError,
+                     "cannot unpack columns with a struct of length 0");
+        return NULL;
+    }
+    if (buffer->len % self->s_size != 0) {
+        PyErr_Format(state->StructError,
+                     "unpacking columns requires a buffer of "
+                     "a multiple of %zd bytes",
+                     self->s_size);
+        return NULL;
+    }
+    n = buffer->len / self->s_size;
+
+    result = PyTuple_New(self->s_len);
+    if (result == NULL) {
+        return NULL;
+    }
+    for (code = self->s_codes; code->fmtdef != NULL; code++) {
+        const char *src = (const char *)buffer->buf + code->offset;
+        Py_ssize_t j;
+        for (j = 0; j < code->repeat; j++) {
+            PyObject *column = unpack_column(state, code, src, n,
+                                             self->s_size);
+            if (column == NULL) {
+                Py_DECREF(result);
+                return NULL;
+            }
+            PyTuple_SET_ITEM(result, i++, column);
+            src += code->size;
+        }
+    }
+    return result;
+}
+
+/* Pack the value v of a format code at res.  Return 0 on success, -1 on
+   error. */
+static int
+s_pack_value(_structmodulestate *state, const formatcode *code, char *res,
+             PyObject *v)
+{
+    const formatdef *e = code->fmtdef;
+    if (e->format == 's') {
+        Py_ssize_t n;
+        int isstring;
+        const void *p;
+        isstring = PyBytes_Check(v);
+        if (!isstring && !PyByteArray_Check(v)) {
+            PyErr_SetString(state->StructError,
+                            "argument for 's' must be a bytes object");
+            return -1;
+        }
+        if (isstring) {
+            n = PyBytes_GET_SIZE(v);
+            p = PyBytes_AS_STRING(v);
+        }
+        else {
+            n = PyByteArray_GET_SIZE(v);
+            p = PyByteArray_AS_STRING(v);
+        }
+        if (n > code->size)
+            n = code->size;
+        if (n > 0)
+            memcpy(res, p, n);
+    } else if (e->format == 'p') {
+        Py_ssize_t n;
+        int isstring;
+        const void *p;
+        isstring = PyBytes_Check(v);
+        if (!isstring && !PyByteArray_Check(v)) {
+            PyErr_SetString(state->StructError,
+                            "argument for 'p' must be a bytes object");
+            return -1;
+        }
+        if (isstring) {
+            n = PyBytes_GET_SIZE(v);
+            p = PyBytes_AS_STRING(v);
+        }
+        else {
+            n = PyByteArray_GET_SIZE(v);
+            p = PyByteArray_AS_STRING(v);
+        }
+        if (n > (code->size - 1))
+            n = code->size - 1;
+        if (n > 0)
+            memcpy(res + 1, p, n);
+        if (n > 255)
+            n = 255;
+        *res = Py_SAFE_DOWNCAST(n, Py_ssize_t, unsigned char);
+    } else {
+        if (e->pack(state, res, v, e) < 0) {
+            if (PyLong_Check(v) && PyErr_ExceptionMatches(PyExc_OverflowError))
+                PyErr_SetString(state->StructError,
+                                "int too large to convert");
+            return -1;
+        }
+    }
+    return 0;
+}
+
 /*
  * Guts of the pack function.
  *
@@ -1930,65 +2209,11 @@ s_pack_internal(PyStructObject *soself, PyObject *const *args, int offset,
     memset(buf, '\0', soself->s_size);
     i = offset;
     for (code = soself->s_codes; code->fmtdef != NULL; code++) {
-        const formatdef *e = code->fmtdef;
         char *res = buf + code->offset;
         Py_ssize_t j = code->repeat;
         while (j--) {
-            PyObject *v = args[i++];
-            if (e->format == 's') {
-                Py_ssize_t n;
-                int isstring;
-                const void *p;
-                isstring = PyBytes_Check(v);
-                if (!isstring && !PyByteArray_Check(v)) {
-                    PyErr_SetString(state->StructError,
-                                    "argument for 's' must be a bytes object");
-                    return -1;
-                }
-                if (isstring) {
-                    n = PyBytes_GET_SIZE(v);
-                    p = PyBytes_AS_STRING(v);
-                }
-                else {
-                    n = PyByteArray_GET_SIZE(v);
-                    p = PyByteArray_AS_STRING(v);
-                }
-                if (n > code->size)
-                    n = code->size;
-                if (n > 0)
-                    memcpy(res, p, n);
-            } else if (e->format == 'p') {
-                Py_ssize_t n;
-                int isstring;
-                const void *p;
-                isstring = PyBytes_Check(v);
-                if (!isstring && !PyByteArray_Check(v)) {
-                    PyErr_SetString(state->StructError,
-                                    "argument for 'p' must be a bytes object");
-                    return -1;
-                }
-                if (isstring) {
-                    n = PyBytes_GET_SIZE(v);
-                    p = PyBytes_AS_STRING(v);
-                }
-                else {
-                    n = PyByteArray_GET_SIZE(v);
-                    p = PyByteArray_AS_STRING(v);
-                }
-                if (n > (code->size - 1))
-                    n = code->size - 1;
-                if (n > 0)
-                    memcpy(res + 1, p, n);
-                if (n > 255)
-                    n = 255;
-                *res = Py_SAFE_DOWNCAST(n, Py_ssize_t, unsigned char);
-            } else {
-                if (e->pack(state, res, v, e) < 0) {
-                    if (PyLong_Check(v) && PyErr_ExceptionMatches(PyExc_OverflowError))
-                        PyErr_SetString(state->StructError,
-                                        "int too large to convert");
-                    return -1;
-                }
+            if (s_pack_value(state, code, res, args[i++]) < 0) {
+                return -1;
             }
             res += code->size;
         }
@@ -1998,7 +2223,6 @@ s_pack_internal(PyStructObject *soself, PyObject *const *args, int offset,
     return 0;
 }
 
-
 PyDoc_STRVAR(s_pack__doc__,
 "S.pack(v1, v2, ...) -> bytes\n\
 \n\
@@ -2144,6 +2368,175 @@ s_pack_into(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
     Py_RETURN_NONE;
 }
 
+/* Get the buffer of a column of values of a format code, if the column
+   holds them contiguously in the native type of the same size.  Return 1 if
+   view was filled, 0 if the column must be iterated instead, or -1 on
+   error. */
+static int
+get_column_buffer(const formatcode *code, PyObject *column, Py_buffer *view,
+                  int *swap)
+{
+    const formatdef *e = code->fmtdef;
+    const char *format;
+    char native = column_format(e, swap);
+
+    if (native == 0 || (e->format == '?' && e->size != 1)
+        || !PyObject_CheckBuffer(column))
+    {
+        return 0;
+    }
+    if (PyObject_GetBuffer(column, view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+        if (!PyErr_ExceptionMatches(PyExc_BufferError)) {
+            return -1;
+        }
+        PyErr_Clear();
+        return 0;
+    }
+    format = view->format;
+    if (format[0] == '@') {
+        format++;
+    }
+    if (view->ndim != 1 || view->itemsize != e->size
+        || format[0] != native || format[1] != '\0')
+    {
+        PyBuffer_Release(view);
+        return 0;
+    }
+    return 1;
+}
+
+PyDoc_STRVAR(s_pack_columns__doc__,
+"S.pack_columns(column1, column2, ...) -> bytes\n\
+\n\
+Return a bytes object holding one record per row of the columns, packed\n\
+according to the format string S.format.  There is one column per value\n\
+of the format: either a sequence of values, or a contiguous buffer of the\n\
+native type of the same size, like the columns returned by\n\
+S.unpack_columns().  All the columns must have the same length.  See\n\
+help(struct) for more on format strings.");
+
+static PyObject *
+s_pack_columns(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyStructObject *soself = (PyStructObject *)self;
+    _structmodulestate *state = get_struct_state_structinst(self);
+    formatcode *code;
+    Py_buffer *views = NULL;
+    PyObject **seqs = NULL;
+    int *swaps = NULL;
+    PyObject *result = NULL;
+    Py_ssize_t i, n = 0;
+    char *buf;
+
+    assert(PyStruct_Check(self, state));
+    assert(soself->s_codes != NULL);
+    if (nargs != soself->s_len) {
+        PyErr_Format(state->StructError,
+                     "pack_columns expected %zd columns (got %zd)",
+                     soself->s_len, nargs);
+        return NULL;
+    }
+
+    views = PyMem_Calloc(nargs + 1, sizeof(Py_buffer));
+    seqs = PyMem_Calloc(nargs + 1, sizeof(PyObject *));
+    swaps = PyMem_Calloc(nargs + 1, sizeof(int));
+    if (views == NULL || seqs == NULL || swaps == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    /* Check the columns, and get their common length */
+    i = 0;
+    for (code = soself->s_codes; code->fmtdef != NULL; code++) {
+        Py_ssize_t j, len;
+        for (j = 0; j < code->repeat; j++, i++) {
+            int res = get_column_buffer(code, args[i], &views[i], &swaps[i]);
+            if (res < 0) {
+                goto done;
+            }
+            if (res) {
+                len = views[i].len / views[i].itemsize;
+            }
+            else {
+                seqs[i] = PySequence_Fast(args[i],
+                                          "pack_columns expected a sequence "
+                                          "or a buffer for each column");
+                if (seqs[i] == NULL) {
+                    goto done;
+                }
+                len = PySequence_Fast_GET_SIZE(seqs[i]);
+            }
+            if (i == 0) {
+                n = len;
+            }
+            else if (len != n) {
+                PyErr_SetString(state->StructError,
+                                "pack_columns requires columns of "
+                                "the same length");
+                goto done;
+            }
+        }
+    }
+
+    if (n > PY_SSIZE_T_MAX / Py_MAX(soself->s_size, 1)) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    result = PyBytes_FromStringAndSize(NULL, n * soself->s_size);
+    if (result == NULL) {
+        goto done;
+    }
+    buf = PyBytes_AS_STRING(result);
+    memset(buf, '\0', n * soself->s_size);
+
+    i = 0;
+    for (code = soself->s_codes; code->fmtdef != NULL; code++) {
+        char *dst = buf + code->offset;
+        Py_ssize_t j, r;
+        for (j = 0; j < code->repeat; j++, i++, dst += code->size) {
+            if (views[i].obj != NULL) {
+                copy_column(dst, soself->s_size, views[i].buf,
+                            views[i].itemsize, n, code->size, swaps[i],
+                            code->fmtdef->format == '?');
+                continue;
+            }
+            for (r = 0; r < n; r++) {
+                PyObject *v;
+                int res;
+                /* Packing a value may run code mutating the sequence */
+                if (r >= PySequence_Fast_GET_SIZE(seqs[i])) {
+                    PyErr_SetString(state->StructError,
+                                    "pack_columns column changed size "
+                                    "during packing");
+                    Py_CLEAR(result);
+                    goto done;
+                }
+                v = Py_NewRef(PySequence_Fast_GET_ITEM(seqs[i], r));
+                res = s_pack_value(state, code, dst + r * soself->s_size, v);
+                Py_DECREF(v);
+                if (res < 0) {
+                    Py_CLEAR(result);
+                    goto done;
+                }
+            }
+        }
+    }
+
+done:
+    if (views != NULL && seqs != NULL) {
+        for (i = 0; i < nargs; i++) {
+            if (views[i].obj != NULL) {
+                PyBuffer_Release(&views[i]);
+            }
+            Py_XDECREF(seqs[i]);
+        }
+    }
+    PyMem_Free(views);
+    PyMem_Free(seqs);
+    PyMem_Free(swaps);
+    return result;
+}
+
 static PyObject *
 s_get_format(PyStructObject *self, void *unused)
 {
@@ -2176,8 +2569,10 @@ static struct PyMethodDef s_methods[] = {
     STRUCT_ITER_UNPACK_METHODDEF
     {"pack",            _PyCFunction_CAST(s_pack), METH_FASTCALL, s_pack__doc__},
     {"pack_into",       _PyCFunction_CAST(s_pack_into), METH_FASTCALL, s_pack_into__doc__},
+    {"pack_columns",    _PyCFunction_CAST(s_pack_columns), METH_FASTCALL, s_pack_columns__doc__},
     STRUCT_UNPACK_METHODDEF
     STRUCT_UNPACK_FROM_METHODDEF
+    STRUCT_UNPACK_COLUMNS_METHODDEF
     {"__sizeof__",      (PyCFunction)s_sizeof, METH_NOARGS, s_sizeof__doc__},
     {NULL,       NULL}          /* sentinel */
 };
@@ -2419,14 +2814,65 @@ iter_unpack_impl(PyObject *module, PyStructObject *s_object,
     return Struct_iter_unpack(s_object, buffer);
 }
 
+PyDoc_STRVAR(pack_columns_doc,
+"pack_columns(format, column1, column2, ...) -> bytes\n\
+\n\
+Return a bytes object holding one record per row of the columns, packed\n\
+according to the format string.  See help(struct) for more on format\n\
+strings.");
+
+static PyObject *
+pack_columns(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *s_object = NULL;
+    PyObject *format, *result;
+
+    if (nargs == 0) {
+        PyErr_SetString(PyExc_TypeError, "missing format argument");
+        return NULL;
+    }
+    format = args[0];
+
+    if (!cache_struct_converter(module, format, (PyStructObject **)&s_object)) {
+        return NULL;
+    }
+    result = s_pack_columns(s_object, args + 1, nargs - 1);
+    Py_DECREF(s_object);
+    return result;
+}
+
+/*[clinic input]
+unpack_columns
+
+    format as s_object: cache_struct
+    buffer: Py_buffer
+    /
+
+Return a tuple of columns unpacked according to the format string.
+
+The bytes hold consecutive records, each of calcsize(format) bytes.
+
+See help(struct) for more on format strings.
+[clinic start generated code]*/
+
+static PyObject *
+unpack_columns_impl(PyObject *module, PyStructObject *s_object,
+                    Py_buffer *buffer)
+/*[clinic end generated code: output=f4087de29de91fc5 input=1b5297ad6c83118b]*/
+{
+    return Struct_unpack_columns_impl(s_object, buffer);
+}
+
 static struct PyMethodDef module_functions[] = {
     _CLEARCACHE_METHODDEF
     CALCSIZE_METHODDEF
     ITER_UNPACK_METHODDEF
     {"pack",            _PyCFunction_CAST(pack), METH_FASTCALL,   pack_doc},
     {"pack_into",       _PyCFunction_CAST(pack_into), METH_FASTCALL,   pack_into_doc},
+    {"pack_columns",    _PyCFunction_CAST(pack_columns), METH_FASTCALL,   pack_columns_doc},
     UNPACK_METHODDEF
     UNPACK_FROM_METHODDEF
+    UNPACK_COLUMNS_METHODDEF
     {NULL,       NULL}          /* sentinel */
 };
 
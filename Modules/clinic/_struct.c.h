@@ -214,6 +214,49 @@ PyDoc_STRVAR(Struct_iter_unpack__doc__,
 #define STRUCT_ITER_UNPACK_METHODDEF    \
     {"iter_unpack", (PyCFunction)Struct_iter_unpack, METH_O, Struct_iter_unpack__doc__},
 
+PyDoc_STRVAR(Struct_unpack_columns__doc__,
+"unpack_columns($self, buffer, /)\n"
+"--\n"
+"\n"
+"Return a tuple of columns unpacked from the given bytes.\n"
+"\n"
+"The bytes hold consecutive records, each of Struct.size bytes.  There is\n"
+"one column per value of the format: a memoryview holding the value of\n"
+"every record in the native type of the same size, or a list of bytes for\n"
+"\'s\' and \'p\' values.\n"
+"\n"
+"Requires that the bytes length be a multiple of the struct size.");
+
+#define STRUCT_UNPACK_COLUMNS_METHODDEF    \
+    {"unpack_columns", (PyCFunction)Struct_unpack_columns, METH_O, Struct_unpack_columns__doc__},
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer);
+
+static PyObject *
+Struct_unpack_columns(PyStructObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+
+    if (PyObject_GetBuffer(arg, &buffer, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("unpack_columns", "argument", "contiguous buffer", arg);
+        goto exit;
+    }
+    return_value = Struct_unpack_columns_impl(self, &buffer);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_clearcache__doc__,
 "_clearcache($module, /)\n"
 "--\n"
@@ -451,4 +494,54 @@ exit:
 
     return return_value;
 }
-/*[clinic end generated code: output=f3d6e06f80368998 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(unpack_columns__doc__,
+"unpack_columns($module, format, buffer, /)\n"
+"--\n"
+"\n"
+"Return a tuple of columns unpacked according to the format string.\n"
+"\n"
+"The bytes hold consecutive records, each of calcsize(format) bytes.\n"
+"\n"
+"See help(struct) for more on format strings.");
+
+#define UNPACK_COLUMNS_METHODDEF    \
+    {"unpack_columns", _PyCFunction_CAST(unpack_columns), METH_FASTCALL, unpack_columns__doc__},
+
+static PyObject *
+unpack_columns_impl(PyObject *module, PyStructObject *s_object,
+                    Py_buffer *buffer);
+
+static PyObject *
+unpack_columns(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyStructObject *s_object = NULL;
+    Py_buffer buffer = {NULL, NULL};
+
+    if (!_PyArg_CheckPositional("unpack_columns", nargs, 2, 2)) {
+        goto exit;
+    }
+    if (!cache_struct_converter(module, args[0], &s_object)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("unpack_columns", "argument 2", "contiguous buffer", args[1]);
+        goto exit;
+    }
+    return_value = unpack_columns_impl(module, s_object, &buffer);
+
+exit:
+    /* Cleanup for s_object */
+    Py_XDECREF(s_object);
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+/*[clinic end generated code: output=ce01da9c1acca858 input=a9049054013a1b77]*/
@@ -1034,6 +1034,849 @@ exit:
 
 #endif /* defined(HAVE_EPOLL) */
 
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring__doc__,
+"io_uring(entries=256)\n"
+"--\n"
+"\n"
+"Returns an io_uring object.\n"
+"\n"
+"  entries\n"
+"    The size of the submission ring.  The kernel rounds it up to a power\n"
+"    of two.");
+
+static PyObject *
+select_io_uring_impl(PyTypeObject *type, unsigned int entries);
+
+static PyObject *
+select_io_uring(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(entries), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"entries", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "io_uring",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    PyObject * const *fastargs;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(args);
+    Py_ssize_t noptargs = nargs + (kwargs ? PyDict_GET_SIZE(kwargs) : 0) - 0;
+    unsigned int entries = 256;
+
+    fastargs = _PyArg_UnpackKeywords(_PyTuple_CAST(args)->ob_item, nargs, kwargs, NULL, &_parser, 0, 1, 0, argsbuf);
+    if (!fastargs) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (!_PyLong_UnsignedInt_Converter(fastargs[0], &entries)) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = select_io_uring_impl(type, entries);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_close__doc__,
+"close($self, /)\n"
+"--\n"
+"\n"
+"Close the io_uring file descriptor.\n"
+"\n"
+"Operations still in flight are cancelled, and close() waits until the\n"
+"kernel is done with their buffers.  Further operations on the io_uring\n"
+"object will raise an exception.");
+
+#define SELECT_IO_URING_CLOSE_METHODDEF    \
+    {"close", (PyCFunction)select_io_uring_close, METH_NOARGS, select_io_uring_close__doc__},
+
+static PyObject *
+select_io_uring_close_impl(pyIoUring_Object *self);
+
+static PyObject *
+select_io_uring_close(pyIoUring_Object *self, PyObject *Py_UNUSED(ignored))
+{
+    return select_io_uring_close_impl(self);
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_fileno__doc__,
+"fileno($self, /)\n"
+"--\n"
+"\n"
+"Return the io_uring file descriptor.\n"
+"\n"
+"It polls as readable when completions are available.");
+
+#define SELECT_IO_URING_FILENO_METHODDEF    \
+    {"fileno", (PyCFunction)select_io_uring_fileno, METH_NOARGS, select_io_uring_fileno__doc__},
+
+static PyObject *
+select_io_uring_fileno_impl(pyIoUring_Object *self);
+
+static PyObject *
+select_io_uring_fileno(pyIoUring_Object *self, PyObject *Py_UNUSED(ignored))
+{
+    return select_io_uring_fileno_impl(self);
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_read__doc__,
+"read($self, /, fd, buffer, offset=-1, user_data=0, flags=0)\n"
+"--\n"
+"\n"
+"Queue a read into buffer.\n"
+"\n"
+"  fd\n"
+"    the file descriptor to read from\n"
+"  buffer\n"
+"    a writable bytes-like object receiving the data\n"
+"  offset\n"
+"    the file offset to read at; -1 reads at, and advances, the current\n"
+"    file position\n"
+"  user_data\n"
+"    the value reported along with the result of the operation\n"
+"  flags\n"
+"    a bit set composed of the IOSQE constants\n"
+"\n"
+"The read is handed to the kernel by the next call to submit().  The buffer\n"
+"must not be used until completions() has reported the read.");
+
+#define SELECT_IO_URING_READ_METHODDEF    \
+    {"read", _PyCFunction_CAST(select_io_uring_read), METH_FASTCALL|METH_KEYWORDS, select_io_uring_read__doc__},
+
+static PyObject *
+select_io_uring_read_impl(pyIoUring_Object *self, int fd, Py_buffer *buffer,
+                          long long offset, unsigned long long user_data,
+                          unsigned int flags);
+
+static PyObject *
+select_io_uring_read(pyIoUring_Object *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 5
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(fd), &_Py_ID(buffer), &_Py_ID(offset), &_Py_ID(user_data), &_Py_ID(flags), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"fd", "buffer", "offset", "user_data", "flags", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "read",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[5];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
+    int fd;
+    Py_buffer buffer = {NULL, NULL};
+    long long offset = -1;
+    unsigned long long user_data = 0;
+    unsigned int flags = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 2, 5, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!_PyLong_FileDescriptor_Converter(args[0], &fd)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &buffer, PyBUF_WRITABLE) < 0) {
+        PyErr_Clear();
+        _PyArg_BadArgument("read", "argument 'buffer'", "read-write bytes-like object", args[1]);
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("read", "argument 'buffer'", "contiguous buffer", args[1]);
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[2]) {
+        offset = PyLong_AsLongLong(args[2]);
+        if (offset == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    if (args[3]) {
+        if (!_PyLong_UnsignedLongLong_Converter(args[3], &user_data)) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    flags = (unsigned int)PyLong_AsUnsignedLongMask(args[4]);
+    if (flags == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = select_io_uring_read_impl(self, fd, &buffer, offset, user_data, flags);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_write__doc__,
+"write($self, /, fd, data, offset=-1, user_data=0, flags=0)\n"
+"--\n"
+"\n"
+"Queue a write of data.\n"
+"\n"
+"  fd\n"
+"    the file descriptor to write to\n"
+"  data\n"
+"    a bytes-like object holding the data\n"
+"  offset\n"
+"    the file offset to write at; -1 writes at, and advances, the current\n"
+"    file position\n"
+"  user_data\n"
+"    the value reported along with the result of the operation\n"
+"  flags\n"
+"    a bit set composed of the IOSQE constants\n"
+"\n"
+"The write is handed to the kernel by the next call to submit().");
+
+#define SELECT_IO_URING_WRITE_METHODDEF    \
+    {"write", _PyCFunction_CAST(select_io_uring_write), METH_FASTCALL|METH_KEYWORDS, select_io_uring_write__doc__},
+
+static PyObject *
+select_io_uring_write_impl(pyIoUring_Object *self, int fd, Py_buffer *data,
+                           long long offset, unsigned long long user_data,
+                           unsigned int flags);
+
+static PyObject *
+select_io_uring_write(pyIoUring_Object *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 5
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(fd), &_Py_ID(data), &_Py_ID(offset), &_Py_ID(user_data), &_Py_ID(flags), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"fd", "data", "offset", "user_data", "flags", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "write",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[5];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
+    int fd;
+    Py_buffer data = {NULL, NULL};
+    long long offset = -1;
+    unsigned long long user_data = 0;
+    unsigned int flags = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 2, 5, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!_PyLong_FileDescriptor_Converter(args[0], &fd)) {
+        goto exit;
+    }
+    if (PyObject_GetBuffer(args[1], &data, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&data, 'C')) {
+        _PyArg_BadArgument("write", "argument 'data'", "contiguous buffer", args[1]);
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[2]) {
+        offset = PyLong_AsLongLong(args[2]);
+        if (offset == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    if (args[3]) {
+        if (!_PyLong_UnsignedLongLong_Converter(args[3], &user_data)) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    flags = (unsigned int)PyLong_AsUnsignedLongMask(args[4]);
+    if (flags == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = select_io_uring_write_impl(self, fd, &data, offset, user_data, flags);
+
+exit:
+    /* Cleanup for data */
+    if (data.obj) {
+       PyBuffer_Release(&data);
+    }
+
+    return return_value;
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_read_fixed__doc__,
+"read_fixed($self, /, fd, buf_index, offset=-1, user_data=0, flags=0)\n"
+"--\n"
+"\n"
+"Queue a read into a registered buffer.\n"
+"\n"
+"  fd\n"
+"    the file descriptor to read from\n"
+"  buf_index\n"
+"    the index of a buffer registered with register_buffers()\n"
+"  offset\n"
+"    the file offset to read at; -1 reads at, and advances, the current\n"
+"    file position\n"
+"  user_data\n"
+"    the value reported along with the result of the operation\n"
+"  flags\n"
+"    a bit set composed of the IOSQE constants");
+
+#define SELECT_IO_URING_READ_FIXED_METHODDEF    \
+    {"read_fixed", _PyCFunction_CAST(select_io_uring_read_fixed), METH_FASTCALL|METH_KEYWORDS, select_io_uring_read_fixed__doc__},
+
+static PyObject *
+select_io_uring_read_fixed_impl(pyIoUring_Object *self, int fd,
+                                int buf_index, long long offset,
+                                unsigned long long user_data,
+                                unsigned int flags);
+
+static PyObject *
+select_io_uring_read_fixed(pyIoUring_Object *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 5
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(fd), &_Py_ID(buf_index), &_Py_ID(offset), &_Py_ID(user_data), &_Py_ID(flags), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"fd", "buf_index", "offset", "user_data", "flags", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "read_fixed",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[5];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
+    int fd;
+    int buf_index;
+    long long offset = -1;
+    unsigned long long user_data = 0;
+    unsigned int flags = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 2, 5, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!_PyLong_FileDescriptor_Converter(args[0], &fd)) {
+        goto exit;
+    }
+    buf_index = _PyLong_AsInt(args[1]);
+    if (buf_index == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[2]) {
+        offset = PyLong_AsLongLong(args[2]);
+        if (offset == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    if (args[3]) {
+        if (!_PyLong_UnsignedLongLong_Converter(args[3], &user_data)) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    flags = (unsigned int)PyLong_AsUnsignedLongMask(args[4]);
+    if (flags == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = select_io_uring_read_fixed_impl(self, fd, buf_index, offset, user_data, flags);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_write_fixed__doc__,
+"write_fixed($self, /, fd, buf_index, offset=-1, user_data=0, flags=0)\n"
+"--\n"
+"\n"
+"Queue a write of a whole registered buffer.\n"
+"\n"
+"  fd\n"
+"    the file descriptor to write to\n"
+"  buf_index\n"
+"    the index of a buffer registered with register_buffers()\n"
+"  offset\n"
+"    the file offset to write at; -1 writes at, and advances, the current\n"
+"    file position\n"
+"  user_data\n"
+"    the value reported along with the result of the operation\n"
+"  flags\n"
+"    a bit set composed of the IOSQE constants");
+
+#define SELECT_IO_URING_WRITE_FIXED_METHODDEF    \
+    {"write_fixed", _PyCFunction_CAST(select_io_uring_write_fixed), METH_FASTCALL|METH_KEYWORDS, select_io_uring_write_fixed__doc__},
+
+static PyObject *
+select_io_uring_write_fixed_impl(pyIoUring_Object *self, int fd,
+                                 int buf_index, long long offset,
+                                 unsigned long long user_data,
+                                 unsigned int flags);
+
+static PyObject *
+select_io_uring_write_fixed(pyIoUring_Object *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 5
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(fd), &_Py_ID(buf_index), &_Py_ID(offset), &_Py_ID(user_data), &_Py_ID(flags), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"fd", "buf_index", "offset", "user_data", "flags", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "write_fixed",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[5];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 2;
+    int fd;
+    int buf_index;
+    long long offset = -1;
+    unsigned long long user_data = 0;
+    unsigned int flags = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 2, 5, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!_PyLong_FileDescriptor_Converter(args[0], &fd)) {
+        goto exit;
+    }
+    buf_index = _PyLong_AsInt(args[1]);
+    if (buf_index == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (args[2]) {
+        offset = PyLong_AsLongLong(args[2]);
+        if (offset == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    if (args[3]) {
+        if (!_PyLong_UnsignedLongLong_Converter(args[3], &user_data)) {
+            goto exit;
+        }
+        if (!--noptargs) {
+            goto skip_optional_pos;
+        }
+    }
+    flags = (unsigned int)PyLong_AsUnsignedLongMask(args[4]);
+    if (flags == (unsigned int)-1 && PyErr_Occurred()) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = select_io_uring_write_fixed_impl(self, fd, buf_index, offset, user_data, flags);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_submit__doc__,
+"submit($self, /, wait=0)\n"
+"--\n"
+"\n"
+"Hand the queued operations to the kernel, in a single system call.\n"
+"\n"
+"  wait\n"
+"    the number of completions to wait for\n"
+"\n"
+"Returns the number of operations submitted.");
+
+#define SELECT_IO_URING_SUBMIT_METHODDEF    \
+    {"submit", _PyCFunction_CAST(select_io_uring_submit), METH_FASTCALL|METH_KEYWORDS, select_io_uring_submit__doc__},
+
+static PyObject *
+select_io_uring_submit_impl(pyIoUring_Object *self, unsigned int wait);
+
+static PyObject *
+select_io_uring_submit(pyIoUring_Object *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(wait), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"wait", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "submit",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t noptargs = nargs + (kwnames ? PyTuple_GET_SIZE(kwnames) : 0) - 0;
+    unsigned int wait = 0;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 0, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (!noptargs) {
+        goto skip_optional_pos;
+    }
+    if (!_PyLong_UnsignedInt_Converter(args[0], &wait)) {
+        goto exit;
+    }
+skip_optional_pos:
+    return_value = select_io_uring_submit_impl(self, wait);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_completions__doc__,
+"completions($self, /)\n"
+"--\n"
+"\n"
+"Reap the completed operations.\n"
+"\n"
+"Returns a list of (user_data, result) 2-tuples, where result is the number\n"
+"of bytes transferred, or a negated errno value if the operation failed.");
+
+#define SELECT_IO_URING_COMPLETIONS_METHODDEF    \
+    {"completions", (PyCFunction)select_io_uring_completions, METH_NOARGS, select_io_uring_completions__doc__},
+
+static PyObject *
+select_io_uring_completions_impl(pyIoUring_Object *self);
+
+static PyObject *
+select_io_uring_completions(pyIoUring_Object *self, PyObject *Py_UNUSED(ignored))
+{
+    return select_io_uring_completions_impl(self);
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_register_buffers__doc__,
+"register_buffers($self, buffers, /)\n"
+"--\n"
+"\n"
+"Register buffers for read_fixed() and write_fixed().\n"
+"\n"
+"  buffers\n"
+"    a sequence of writable bytes-like objects\n"
+"\n"
+"The kernel maps registered buffers once, instead of on every operation.\n"
+"They stay exported until unregister_buffers() or close() is called.");
+
+#define SELECT_IO_URING_REGISTER_BUFFERS_METHODDEF    \
+    {"register_buffers", (PyCFunction)select_io_uring_register_buffers, METH_O, select_io_uring_register_buffers__doc__},
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_unregister_buffers__doc__,
+"unregister_buffers($self, /)\n"
+"--\n"
+"\n"
+"Unregister the buffers registered by register_buffers().");
+
+#define SELECT_IO_URING_UNREGISTER_BUFFERS_METHODDEF    \
+    {"unregister_buffers", (PyCFunction)select_io_uring_unregister_buffers, METH_NOARGS, select_io_uring_unregister_buffers__doc__},
+
+static PyObject *
+select_io_uring_unregister_buffers_impl(pyIoUring_Object *self);
+
+static PyObject *
+select_io_uring_unregister_buffers(pyIoUring_Object *self, PyObject *Py_UNUSED(ignored))
+{
+    return select_io_uring_unregister_buffers_impl(self);
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_register_eventfd__doc__,
+"register_eventfd($self, fd, /)\n"
+"--\n"
+"\n"
+"Signal the eventfd whenever an operation completes.\n"
+"\n"
+"  fd\n"
+"    an eventfd file descriptor, see os.eventfd()\n"
+"\n"
+"This lets an event loop wait for completions along with its other file\n"
+"descriptors.");
+
+#define SELECT_IO_URING_REGISTER_EVENTFD_METHODDEF    \
+    {"register_eventfd", (PyCFunction)select_io_uring_register_eventfd, METH_O, select_io_uring_register_eventfd__doc__},
+
+static PyObject *
+select_io_uring_register_eventfd_impl(pyIoUring_Object *self, int fd);
+
+static PyObject *
+select_io_uring_register_eventfd(pyIoUring_Object *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int fd;
+
+    if (!_PyLong_FileDescriptor_Converter(arg, &fd)) {
+        goto exit;
+    }
+    return_value = select_io_uring_register_eventfd_impl(self, fd);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring_unregister_eventfd__doc__,
+"unregister_eventfd($self, /)\n"
+"--\n"
+"\n"
+"Stop signalling the eventfd registered by register_eventfd().");
+
+#define SELECT_IO_URING_UNREGISTER_EVENTFD_METHODDEF    \
+    {"unregister_eventfd", (PyCFunction)select_io_uring_unregister_eventfd, METH_NOARGS, select_io_uring_unregister_eventfd__doc__},
+
+static PyObject *
+select_io_uring_unregister_eventfd_impl(pyIoUring_Object *self);
+
+static PyObject *
+select_io_uring_unregister_eventfd(pyIoUring_Object *self, PyObject *Py_UNUSED(ignored))
+{
+    return select_io_uring_unregister_eventfd_impl(self);
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring___enter____doc__,
+"__enter__($self, /)\n"
+"--\n"
+"\n");
+
+#define SELECT_IO_URING___ENTER___METHODDEF    \
+    {"__enter__", (PyCFunction)select_io_uring___enter__, METH_NOARGS, select_io_uring___enter____doc__},
+
+static PyObject *
+select_io_uring___enter___impl(pyIoUring_Object *self);
+
+static PyObject *
+select_io_uring___enter__(pyIoUring_Object *self, PyObject *Py_UNUSED(ignored))
+{
+    return select_io_uring___enter___impl(self);
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
+#if defined(HAVE_IO_URING)
+
+PyDoc_STRVAR(select_io_uring___exit____doc__,
+"__exit__($self, exc_type=None, exc_value=None, exc_tb=None, /)\n"
+"--\n"
+"\n");
+
+#define SELECT_IO_URING___EXIT___METHODDEF    \
+    {"__exit__", _PyCFunction_CAST(select_io_uring___exit__), METH_FASTCALL, select_io_uring___exit____doc__},
+
+static PyObject *
+select_io_uring___exit___impl(pyIoUring_Object *self, PyObject *exc_type,
+                              PyObject *exc_value, PyObject *exc_tb);
+
+static PyObject *
+select_io_uring___exit__(pyIoUring_Object *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *exc_type = Py_None;
+    PyObject *exc_value = Py_None;
+    PyObject *exc_tb = Py_None;
+
+    if (!_PyArg_CheckPositional("__exit__", nargs, 0, 3)) {
+        goto exit;
+    }
+    if (nargs < 1) {
+        goto skip_optional;
+    }
+    exc_type = args[0];
+    if (nargs < 2) {
+        goto skip_optional;
+    }
+    exc_value = args[1];
+    if (nargs < 3) {
+        goto skip_optional;
+    }
+    exc_tb = args[2];
+skip_optional:
+    return_value = select_io_uring___exit___impl(self, exc_type, exc_value, exc_tb);
+
+exit:
+    return return_value;
+}
+
+#endif /* defined(HAVE_IO_URING) */
+
 #if defined(HAVE_KQUEUE)
 
 PyDoc_STRVAR(select_kqueue__doc__,
@@ -1294,6 +2137,62 @@ exit:
     #define SELECT_EPOLL___EXIT___METHODDEF
 #endif /* !defined(SELECT_EPOLL___EXIT___METHODDEF) */
 
+#ifndef SELECT_IO_URING_CLOSE_METHODDEF
+    #define SELECT_IO_URING_CLOSE_METHODDEF
+#endif /* !defined(SELECT_IO_URING_CLOSE_METHODDEF) */
+
+#ifndef SELECT_IO_URING_FILENO_METHODDEF
+    #define SELECT_IO_URING_FILENO_METHODDEF
+#endif /* !defined(SELECT_IO_URING_FILENO_METHODDEF) */
+
+#ifndef SELECT_IO_URING_READ_METHODDEF
+    #define SELECT_IO_URING_READ_METHODDEF
+#endif /* !defined(SELECT_IO_URING_READ_METHODDEF) */
+
+#ifndef SELECT_IO_URING_WRITE_METHODDEF
+    #define SELECT_IO_URING_WRITE_METHODDEF
+#endif /* !defined(SELECT_IO_URING_WRITE_METHODDEF) */
+
+#ifndef SELECT_IO_URING_READ_FIXED_METHODDEF
+    #define SELECT_IO_URING_READ_FIXED_METHODDEF
+#endif /* !defined(SELECT_IO_URING_READ_FIXED_METHODDEF) */
+
+#ifndef SELECT_IO_URING_WRITE_FIXED_METHODDEF
+    #define SELECT_IO_URING_WRITE_FIXED_METHODDEF
+#endif /* !defined(SELECT_IO_URING_WRITE_FIXED_METHODDEF) */
+
+#ifndef SELECT_IO_URING_SUBMIT_METHODDEF
+    #define SELECT_IO_URING_SUBMIT_METHODDEF
+#endif /* !defined(SELECT_IO_URING_SUBMIT_METHODDEF) */
+
+#ifndef SELECT_IO_URING_COMPLETIONS_METHODDEF
+    #define SELECT_IO_URING_COMPLETIONS_METHODDEF
+#endif /* !defined(SELECT_IO_URING_COMPLETIONS_METHODDEF) */
+
+#ifndef SELECT_IO_URING_REGISTER_BUFFERS_METHODDEF
+    #define SELECT_IO_URING_REGISTER_BUFFERS_METHODDEF
+#endif /* !defined(SELECT_IO_URING_REGISTER_BUFFERS_METHODDEF) */
+
+#ifndef SELECT_IO_URING_UNREGISTER_BUFFERS_METHODDEF
+    #define SELECT_IO_URING_UNREGISTER_BUFFERS_METHODDEF
+#endif /* !defined(SELECT_IO_URING_UNREGISTER_BUFFERS_METHODDEF) */
+
+#ifndef SELECT_IO_URING_REGISTER_EVENTFD_METHODDEF
+    #define SELECT_IO_URING_REGISTER_EVENTFD_METHODDEF
+#endif /* !defined(SELECT_IO_URING_REGISTER_EVENTFD_METHODDEF) */
+
+#ifndef SELECT_IO_URING_UNREGISTER_EVENTFD_METHODDEF
+    #define SELECT_IO_URING_UNREGISTER_EVENTFD_METHODDEF
+#endif /* !defined(SELECT_IO_URING_UNREGISTER_EVENTFD_METHODDEF) */
+
+#ifndef SELECT_IO_URING___ENTER___METHODDEF
+    #define SELECT_IO_URING___ENTER___METHODDEF
+#endif /* !defined(SELECT_IO_URING___ENTER___METHODDEF) */
+
+#ifndef SELECT_IO_URING___EXIT___METHODDEF
+    #define SELECT_IO_URING___EXIT___METHODDEF
+#endif /* !defined(SELECT_IO_URING___EXIT___METHODDEF) */
+
 #ifndef SELECT_KQUEUE_CLOSE_METHODDEF
     #define SELECT_KQUEUE_CLOSE_METHODDEF
 #endif /* !defined(SELECT_KQUEUE_CLOSE_METHODDEF) */
@@ -1309,4 +2208,4 @@ exit:
 #ifndef SELECT_KQUEUE_CONTROL_METHODDEF
     #define SELECT_KQUEUE_CONTROL_METHODDEF
 #endif /* !defined(SELECT_KQUEUE_CONTROL_METHODDEF) */
-/*[clinic end generated code: output=64516114287e894d input=a9049054013a1b77]*/
+/*[clinic end generated code: output=76e5270244528c5d input=a9049054013a1b77]*/
@@ -41,6 +41,15 @@
 #define FD_SETSIZE 512
 #endif
 
+#if defined(HAVE_LINUX_IO_URING_H) && defined(HAVE_SYS_SYSCALL_H)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+/* IORING_OP_READ and IORING_OP_WRITE came with Linux 5.6 */
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS)
+#define HAVE_IO_URING
+#endif
+#endif
+
 #if defined(HAVE_POLL_H)
 #include <poll.h>
 #elif defined(HAVE_SYS_POLL_H)
@@ -75,6 +84,7 @@ typedef struct {
     PyTypeObject *poll_Type;
     PyTypeObject *devpoll_Type;
     PyTypeObject *pyEpoll_Type;
+    PyTypeObject *pyIoUring_Type;
     PyTypeObject *kqueue_event_Type;
     PyTypeObject *kqueue_queue_Type;
 } _selectstate;
@@ -96,9 +106,10 @@ module select
 class select.poll "pollObject *" "_selectstate_by_type(type)->poll_Type"
 class select.devpoll "devpollObject *" "_selectstate_by_type(type)->devpoll_Type"
 class select.epoll "pyEpoll_Object *" "_selectstate_by_type(type)->pyEpoll_Type"
+class select.io_uring "pyIoUring_Object *" "_selectstate_by_type(type)->pyIoUring_Type"
 class select.kqueue "kqueue_queue_Object *" "_selectstate_by_type(type)->kqueue_queue_Type"
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=8072de35824aa327]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=daa749b086445bd7]*/
 
 /* list of Python objects and their file descriptor */
 typedef struct {
@@ -1693,6 +1704,1021 @@ the maximum number of monitored events.");
 
 #endif /* HAVE_EPOLL */
 
+#ifdef HAVE_IO_URING
+/* **************************************************************************
+ *                      io_uring interface for Linux 5.6+
+ *
+ * Reads and writes are queued in the submission ring, handed to the kernel
+ * in batches by submit() and collected from the completion ring by
+ * completions().  The buffer of an operation stays exported until its
+ * completion has been reaped: the kernel writes into it asynchronously, so
+ * it must be neither resized nor freed in the meantime.
+ */
+
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+/* user_data of the cancellation requests issued when closing */
+#define IO_URING_CANCEL_TAG UINT64_MAX
+
+#define IO_URING_SQE_FLAGS \
+    (IOSQE_IO_DRAIN | IOSQE_IO_LINK | IOSQE_IO_HARDLINK | IOSQE_ASYNC)
+
+typedef struct {
+    Py_buffer view;             /* view.obj is NULL for registered buffers */
+    unsigned long long user_data;
+    Py_ssize_t next_free;
+    char in_use;
+    char fixed;
+} io_uring_op;
+
+typedef struct {
+    PyObject_HEAD
+    int ring_fd;                        /* io_uring file descriptor */
+    int closing;
+    void *sq_ring;
+    size_t sq_ring_size;
+    void *cq_ring;
+    size_t cq_ring_size;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned sq_mask;
+    unsigned sq_entries;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned cq_mask;
+    struct io_uring_cqe *cqes;
+    /* one slot per operation in flight; there are as many slots as entries
+       in the completion ring, so that it never overflows */
+    io_uring_op *ops;
+    Py_ssize_t nops;
+    Py_ssize_t free_op;
+    Py_ssize_t inflight;
+    /* buffers registered with register_buffers() */
+    Py_buffer *fixed;
+    Py_ssize_t nfixed;
+    Py_ssize_t fixed_inflight;
+} pyIoUring_Object;
+
+static PyObject *
+pyiouring_err_closed(void)
+{
+    PyErr_SetString(PyExc_ValueError, "I/O operation on closed io_uring object");
+    return NULL;
+}
+
+static PyObject *
+pyiouring_err_busy(void)
+{
+    errno = EBUSY;
+    PyErr_SetFromErrno(PyExc_OSError);
+    return NULL;
+}
+
+static unsigned
+pyiouring_pending(pyIoUring_Object *self)
+{
+    return *self->sq_tail - __atomic_load_n(self->sq_head, __ATOMIC_ACQUIRE);
+}
+
+static int
+pyiouring_enter_raw(int fd, unsigned to_submit, unsigned min_complete)
+{
+    unsigned flags = min_complete ? IORING_ENTER_GETEVENTS : 0;
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                        flags, NULL, 0);
+}
+
+/* Hand the queued entries to the kernel and wait for min_complete
+   completions.  Return the number of entries submitted, or -1 with an
+   exception set. */
+static int
+pyiouring_enter(pyIoUring_Object *self, unsigned min_complete)
+{
+    int ret, fd;
+    unsigned to_submit;
+
+    do {
+        if (self->ring_fd < 0 || self->closing) {
+            pyiouring_err_closed();
+            return -1;
+        }
+        fd = self->ring_fd;
+        to_submit = pyiouring_pending(self);
+        Py_BEGIN_ALLOW_THREADS
+        errno = 0;
+        ret = pyiouring_enter_raw(fd, to_submit, min_complete);
+        Py_END_ALLOW_THREADS
+        if (ret >= 0) {
+            return ret;
+        }
+    } while (errno == EINTR && !PyErr_CheckSignals());
+
+    if (!PyErr_Occurred()) {
+        PyErr_SetFromErrno(PyExc_OSError);
+    }
+    return -1;
+}
+
+/* Return a zeroed submission entry, or NULL with an exception set.  The
+   entry is queued by pyiouring_push_sqe(). */
+static struct io_uring_sqe *
+pyiouring_get_sqe(pyIoUring_Object *self)
+{
+    struct io_uring_sqe *sqe;
+
+    if (pyiouring_pending(self) >= self->sq_entries) {
+        /* The submission ring is full: make room by submitting it */
+        if (pyiouring_enter(self, 0) < 0) {
+            return NULL;
+        }
+        /* The ring may have been closed while the GIL was released */
+        if (self->ring_fd < 0 || self->closing) {
+            pyiouring_err_closed();
+            return NULL;
+        }
+        if (pyiouring_pending(self) >= self->sq_entries) {
+            pyiouring_err_busy();
+            return NULL;
+        }
+    }
+    sqe = &self->sqes[*self->sq_tail & self->sq_mask];
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+static void
+pyiouring_push_sqe(pyIoUring_Object *self)
+{
+    __atomic_store_n(self->sq_tail, *self->sq_tail + 1, __ATOMIC_RELEASE);
+}
+
+/* Free the slot of a completed operation, moving its buffer to *view */
+static void
+pyiouring_free_op(pyIoUring_Object *self, Py_ssize_t i, Py_buffer *view)
+{
+    io_uring_op *op = &self->ops[i];
+
+    *view = op->view;
+    if (op->fixed) {
+        self->fixed_inflight--;
+    }
+    op->view.obj = NULL;
+    op->in_use = 0;
+    op->fixed = 0;
+    op->next_free = self->free_op;
+    self->free_op = i;
+    self->inflight--;
+}
+
+/* Reap the completions without reporting them */
+static void
+pyiouring_discard_completions(pyIoUring_Object *self)
+{
+    for (;;) {
+        Py_buffer view;
+        unsigned head = *self->cq_head;
+        if (head == __atomic_load_n(self->cq_tail, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+        __u64 user_data = self->cqes[head & self->cq_mask].user_data;
+        __atomic_store_n(self->cq_head, head + 1, __ATOMIC_RELEASE);
+        if (user_data != IO_URING_CANCEL_TAG) {
+            pyiouring_free_op(self, (Py_ssize_t)user_data, &view);
+            PyBuffer_Release(&view);
+        }
+    }
+}
+
+/* Cancel the operations in flight and wait until the kernel is done with
+   them.  Return 0 on success, or -1 if the buffers of some operations could
+   not be reclaimed. */
+static int
+pyiouring_drain(pyIoUring_Object *self)
+{
+    Py_ssize_t i;
+    int ret, fd = self->ring_fd;
+
+    for (i = 0; i < self->nops; i++) {
+        struct io_uring_sqe *sqe;
+        if (!self->ops[i].in_use) {
+            continue;
+        }
+        while (pyiouring_pending(self) >= self->sq_entries) {
+            Py_BEGIN_ALLOW_THREADS
+            ret = pyiouring_enter_raw(fd, pyiouring_pending(self), 0);
+            Py_END_ALLOW_THREADS
+            if (ret < 0 && errno != EINTR && errno != EAGAIN
+                && errno != EBUSY)
+            {
+                return -1;
+            }
+            pyiouring_discard_completions(self);
+        }
+        sqe = &self->sqes[*self->sq_tail & self->sq_mask];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = (__u64)i;
+        sqe->user_data = IO_URING_CANCEL_TAG;
+        pyiouring_push_sqe(self);
+    }
+
+    while (self->inflight > 0) {
+        Py_BEGIN_ALLOW_THREADS
+        ret = pyiouring_enter_raw(fd, pyiouring_pending(self), 1);
+        Py_END_ALLOW_THREADS
+        if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            return -1;
+        }
+        pyiouring_discard_completions(self);
+    }
+    return 0;
+}
+
+static int
+pyiouring_internal_close(pyIoUring_Object *self)
+{
+    int save_errno = 0, drained;
+    Py_ssize_t i;
+
+    if (self->ring_fd < 0 || self->closing) {
+        return 0;
+    }
+    self->closing = 1;
+
+    drained = (self->ops == NULL || pyiouring_drain(self) == 0);
+    if (!drained) {
+        /* The kernel may still write into the buffers of the operations in
+           flight: leak them rather than let their memory be reused */
+        for (i = 0; i < self->nops; i++) {
+            self->ops[i].view.obj = NULL;
+        }
+    }
+
+    if (self->sqes != NULL) {
+        munmap(self->sqes, self->sqes_size);
+        self->sqes = NULL;
+    }
+    if (self->cq_ring != NULL && self->cq_ring != self->sq_ring) {
+        munmap(self->cq_ring, self->cq_ring_size);
+    }
+    self->cq_ring = NULL;
+    if (self->sq_ring != NULL) {
+        munmap(self->sq_ring, self->sq_ring_size);
+        self->sq_ring = NULL;
+    }
+
+    int ring_fd = self->ring_fd;
+    self->ring_fd = -1;
+    Py_BEGIN_ALLOW_THREADS
+    if (close(ring_fd) < 0)
+        save_errno = errno;
+    Py_END_ALLOW_THREADS
+
+    if (self->fixed != NULL) {
+        Py_buffer *fixed = self->fixed;
+        Py_ssize_t nfixed = self->nfixed;
+        self->fixed = NULL;
+        self->nfixed = 0;
+        if (drained) {
+            for (i = 0; i < nfixed; i++) {
+                PyBuffer_Release(&fixed[i]);
+            }
+        }
+        PyMem_Free(fixed);
+    }
+    PyMem_Free(self->ops);
+    self->ops = NULL;
+    self->nops = 0;
+    return save_errno;
+}
+
+static int
+pyiouring_map_rings(pyIoUring_Object *self, struct io_uring_params *p)
+{
+    const int prot = PROT_READ | PROT_WRITE;
+    const int flags = MAP_SHARED | MAP_POPULATE;
+    unsigned i;
+    char *sq, *cq;
+
+    self->sq_ring_size = p->sq_off.array + p->sq_entries * sizeof(unsigned);
+    self->cq_ring_size = (p->cq_off.cqes
+                          + p->cq_entries * sizeof(struct io_uring_cqe));
+    if (p->features & IORING_FEAT_SINGLE_MMAP) {
+        if (self->cq_ring_size > self->sq_ring_size) {
+            self->sq_ring_size = self->cq_ring_size;
+        }
+        self->cq_ring_size = self->sq_ring_size;
+    }
+
+    sq = mmap(NULL, self->sq_ring_size, prot, flags, self->ring_fd,
+              IORING_OFF_SQ_RING);
+    if (sq == MAP_FAILED) {
+        return -1;
+    }
+    self->sq_ring = sq;
+    if (p->features & IORING_FEAT_SINGLE_MMAP) {
+        cq = sq;
+    }
+    else {
+        cq = mmap(NULL, self->cq_ring_size, prot, flags, self->ring_fd,
+                  IORING_OFF_CQ_RING);
+        if (cq == MAP_FAILED) {
+            return -1;
+        }
+    }
+    self->cq_ring = cq;
+    self->sqes_size = p->sq_entries * sizeof(struct io_uring_sqe);
+    self->sqes = mmap(NULL, self->sqes_size, prot, flags, self->ring_fd,
+                      IORING_OFF_SQES);
+    if (self->sqes == MAP_FAILED) {
+        self->sqes = NULL;
+        return -1;
+    }
+
+    self->sq_head = (unsigned *)(sq + p->sq_off.head);
+    self->sq_tail = (unsigned *)(sq + p->sq_off.tail);
+    self->sq_mask = *(unsigned *)(sq + p->sq_off.ring_mask);
+    self->sq_entries = p->sq_entries;
+    /* Submission entries are always used in ring order */
+    unsigned *sq_array = (unsigned *)(sq + p->sq_off.array);
+    for (i = 0; i < p->sq_entries; i++) {
+        sq_array[i] = i;
+    }
+    self->cq_head = (unsigned *)(cq + p->cq_off.head);
+    self->cq_tail = (unsigned *)(cq + p->cq_off.tail);
+    self->cq_mask = *(unsigned *)(cq + p->cq_off.ring_mask);
+    self->cqes = (struct io_uring_cqe *)(cq + p->cq_off.cqes);
+    return 0;
+}
+
+/*[clinic input]
+@classmethod
+select.io_uring.__new__
+
+    entries: unsigned_int(bitwise=False) = 256
+      The size of the submission ring.  The kernel rounds it up to a power
+      of two.
+
+Returns an io_uring object.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_impl(PyTypeObject *type, unsigned int entries)
+/*[clinic end generated code: output=63020d63dc3bde5f input=e09c690a8cf2bb5f]*/
+{
+    pyIoUring_Object *self;
+    struct io_uring_params params;
+    const __u32 features = IORING_FEAT_NODROP | IORING_FEAT_RW_CUR_POS;
+    Py_ssize_t i;
+    int fd;
+
+    if (entries == 0) {
+        PyErr_SetString(PyExc_ValueError, "entries must be positive");
+        return NULL;
+    }
+
+    allocfunc io_uring_alloc = PyType_GetSlot(type, Py_tp_alloc);
+    assert(io_uring_alloc != NULL);
+    self = (pyIoUring_Object *) io_uring_alloc(type, 0);
+    if (self == NULL)
+        return NULL;
+    self->ring_fd = -1;
+    self->free_op = -1;
+
+    memset(&params, 0, sizeof(params));
+    Py_BEGIN_ALLOW_THREADS
+    /* The kernel always creates the file descriptor with O_CLOEXEC */
+    fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    Py_END_ALLOW_THREADS
+    if (fd < 0) {
+        Py_DECREF(self);
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+    self->ring_fd = fd;
+
+    if ((params.features & features) != features) {
+        /* Kernel older than 5.6 */
+        Py_DECREF(self);
+        errno = ENOSYS;
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+    if (pyiouring_map_rings(self, &params) < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    self->ops = PyMem_New(io_uring_op, params.cq_entries);
+    if (self->ops == NULL) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    memset(self->ops, 0, params.cq_entries * sizeof(io_uring_op));
+    self->nops = params.cq_entries;
+    for (i = self->nops - 1; i >= 0; i--) {
+        self->ops[i].next_free = self->free_op;
+        self->free_op = i;
+    }
+    return (PyObject *)self;
+}
+
+static int
+pyiouring_traverse(pyIoUring_Object *self, visitproc visit, void *arg)
+{
+    Py_ssize_t i;
+
+    Py_VISIT(Py_TYPE(self));
+    /* The exporters of the buffers of the operations in flight and of the
+       registered buffers */
+    for (i = 0; i < self->nops; i++) {
+        Py_VISIT(self->ops[i].view.obj);
+    }
+    for (i = 0; i < self->nfixed; i++) {
+        Py_VISIT(self->fixed[i].obj);
+    }
+    return 0;
+}
+
+static int
+pyiouring_clear(pyIoUring_Object *self)
+{
+    /* The buffers can only be released once the kernel is done with them:
+       closing the ring cancels the operations in flight and waits for
+       them. */
+    (void)pyiouring_internal_close(self);
+    return 0;
+}
+
+static void
+pyiouring_dealloc(pyIoUring_Object *self)
+{
+    PyTypeObject* type = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+    (void)pyiouring_internal_close(self);
+    freefunc io_uring_free = PyType_GetSlot(type, Py_tp_free);
+    io_uring_free((PyObject *)self);
+    Py_DECREF((PyObject *)type);
+}
+
+/*[clinic input]
+select.io_uring.close
+
+Close the io_uring file descriptor.
+
+Operations still in flight are cancelled, and close() waits until the
+kernel is done with their buffers.  Further operations on the io_uring
+object will raise an exception.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_close_impl(pyIoUring_Object *self)
+/*[clinic end generated code: output=ab34c3876bdadb71 input=fe0d6fd0897ade75]*/
+{
+    errno = pyiouring_internal_close(self);
+    if (errno != 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+static PyObject*
+pyiouring_get_closed(pyIoUring_Object *self, void *Py_UNUSED(ignored))
+{
+    if (self->ring_fd < 0 || self->closing)
+        Py_RETURN_TRUE;
+    else
+        Py_RETURN_FALSE;
+}
+
+/*[clinic input]
+select.io_uring.fileno
+
+Return the io_uring file descriptor.
+
+It polls as readable when completions are available.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_fileno_impl(pyIoUring_Object *self)
+/*[clinic end generated code: output=7915f2f83c9cd9ae input=ed18980a906cc651]*/
+{
+    if (self->ring_fd < 0 || self->closing)
+        return pyiouring_err_closed();
+    return PyLong_FromLong(self->ring_fd);
+}
+
+/* Queue a read or a write.  On success, the operation takes over the
+   buffer, if any. */
+static PyObject *
+pyiouring_queue_rw(pyIoUring_Object *self, int opcode, int fd,
+                   Py_buffer *buffer, int buf_index, long long offset,
+                   unsigned long long user_data, unsigned int flags)
+{
+    struct io_uring_sqe *sqe;
+    void *addr;
+    Py_ssize_t len, i;
+    int fixed = (buffer == NULL);
+
+    if (self->ring_fd < 0 || self->closing)
+        return pyiouring_err_closed();
+    if (offset < -1) {
+        PyErr_SetString(PyExc_ValueError, "negative offset");
+        return NULL;
+    }
+    if (flags & ~IO_URING_SQE_FLAGS) {
+        PyErr_SetString(PyExc_ValueError, "invalid flags");
+        return NULL;
+    }
+
+    /* May release the GIL */
+    sqe = pyiouring_get_sqe(self);
+    if (sqe == NULL) {
+        return NULL;
+    }
+    if (fixed) {
+        if (buf_index < 0 || buf_index >= self->nfixed) {
+            PyErr_SetString(PyExc_ValueError,
+                            "invalid registered buffer index");
+            return NULL;
+        }
+        addr = self->fixed[buf_index].buf;
+        len = self->fixed[buf_index].len;
+    }
+    else {
+        addr = buffer->buf;
+        len = buffer->len;
+    }
+    /* The result of an operation is a 32-bit signed int */
+    if (len > INT_MAX) {
+        len = INT_MAX;
+    }
+    if (self->free_op < 0) {
+        /* As many operations in flight as completion ring entries */
+        return pyiouring_err_busy();
+    }
+    i = self->free_op;
+    self->free_op = self->ops[i].next_free;
+    if (fixed) {
+        self->ops[i].view.obj = NULL;
+    }
+    else {
+        self->ops[i].view = *buffer;
+        /* The caller must not release the buffer */
+        buffer->obj = NULL;
+    }
+    self->ops[i].user_data = user_data;
+    self->ops[i].in_use = 1;
+    self->ops[i].fixed = fixed;
+    self->inflight++;
+    if (fixed) {
+        self->fixed_inflight++;
+        sqe->buf_index = (__u16)buf_index;
+    }
+
+    sqe->opcode = (__u8)opcode;
+    sqe->flags = (__u8)flags;
+    sqe->fd = fd;
+    sqe->off = (__u64)offset;
+    sqe->addr = (__u64)(uintptr_t)addr;
+    sqe->len = (__u32)len;
+    sqe->user_data = (__u64)i;
+    pyiouring_push_sqe(self);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+select.io_uring.read
+
+    fd: fildes
+      the file descriptor to read from
+    buffer: Py_buffer(accept={rwbuffer})
+      a writable bytes-like object receiving the data
+    offset: long_long = -1
+      the file offset to read at; -1 reads at, and advances, the current
+      file position
+    user_data: unsigned_long_long(bitwise=False) = 0
+      the value reported along with the result of the operation
+    flags: unsigned_int(bitwise=True) = 0
+      a bit set composed of the IOSQE constants
+
+Queue a read into buffer.
+
+The read is handed to the kernel by the next call to submit().  The buffer
+must not be used until completions() has reported the read.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_read_impl(pyIoUring_Object *self, int fd, Py_buffer *buffer,
+                          long long offset, unsigned long long user_data,
+                          unsigned int flags)
+/*[clinic end generated code: output=cc0341d0ec435514 input=e05fcdace8d56236]*/
+{
+    return pyiouring_queue_rw(self, IORING_OP_READ, fd, buffer, 0, offset,
+                              user_data, flags);
+}
+
+/*[clinic input]
+select.io_uring.write
+
+    fd: fildes
+      the file descriptor to write to
+    data: Py_buffer
+      a bytes-like object holding the data
+    offset: long_long = -1
+      the file offset to write at; -1 writes at, and advances, the current
+      file position
+    user_data: unsigned_long_long(bitwise=False) = 0
+      the value reported along with the result of the operation
+    flags: unsigned_int(bitwise=True) = 0
+      a bit set composed of the IOSQE constants
+
+Queue a write of data.
+
+The write is handed to the kernel by the next call to submit().
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_write_impl(pyIoUring_Object *self, int fd, Py_buffer *data,
+                           long long offset, unsigned long long user_data,
+                           unsigned int flags)
+/*[clinic end generated code: output=bd68f18b6eac722b input=fe81bd55df31e3f5]*/
+{
+    return pyiouring_queue_rw(self, IORING_OP_WRITE, fd, data, 0, offset,
+                              user_data, flags);
+}
+
+/*[clinic input]
+select.io_uring.read_fixed
+
+    fd: fildes
+      the file descriptor to read from
+    buf_index: int
+      the index of a buffer registered with register_buffers()
+    offset: long_long = -1
+      the file offset to read at; -1 reads at, and advances, the current
+      file position
+    user_data: unsigned_long_long(bitwise=False) = 0
+      the value reported along with the result of the operation
+    flags: unsigned_int(bitwise=True) = 0
+      a bit set composed of the IOSQE constants
+
+Queue a read into a registered buffer.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_read_fixed_impl(pyIoUring_Object *self, int fd,
+                                int buf_index, long long offset,
+                                unsigned long long user_data,
+                                unsigned int flags)
+/*[clinic end generated code: output=ed8c2b795d7342cd input=8d5cc1321acfe04d]*/
+{
+    return pyiouring_queue_rw(self, IORING_OP_READ_FIXED, fd, NULL,
+                              buf_index, offset, user_data, flags);
+}
+
+/*[clinic input]
+select.io_uring.write_fixed
+
+    fd: fildes
+      the file descriptor to write to
+    buf_index: int
+      the index of a buffer registered with register_buffers()
+    offset: long_long = -1
+      the file offset to write at; -1 writes at, and advances, the current
+      file position
+    user_data: unsigned_long_long(bitwise=False) = 0
+      the value reported along with the result of the operation
+    flags: unsigned_int(bitwise=True) = 0
+      a bit set composed of the IOSQE constants
+
+Queue a write of a whole registered buffer.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_write_fixed_impl(pyIoUring_Object *self, int fd,
+                                 int buf_index, long long offset,
+                                 unsigned long long user_data,
+                                 unsigned int flags)
+/*[clinic end generated code: output=50d95d9d1ee1ca6e input=b06d6d4c1cdb787e]*/
+{
+    return pyiouring_queue_rw(self, IORING_OP_WRITE_FIXED, fd, NULL,
+                              buf_index, offset, user_data, flags);
+}
+
+/*[clinic input]
+select.io_uring.submit
+
+    wait: unsigned_int(bitwise=False) = 0
+      the number of completions to wait for
+
+Hand the queued operations to the kernel, in a single system call.
+
+Returns the number of operations submitted.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_submit_impl(pyIoUring_Object *self, unsigned int wait)
+/*[clinic end generated code: output=70c51523113901f5 input=10b48027f16dbff9]*/
+{
+    int ret;
+
+    if (self->ring_fd < 0 || self->closing)
+        return pyiouring_err_closed();
+    if (wait > self->inflight) {
+        PyErr_SetString(PyExc_ValueError,
+                        "wait exceeds the number of operations in flight");
+        return NULL;
+    }
+    ret = pyiouring_enter(self, wait);
+    if (ret < 0) {
+        return NULL;
+    }
+    return PyLong_FromLong(ret);
+}
+
+/*[clinic input]
+select.io_uring.completions
+
+Reap the completed operations.
+
+Returns a list of (user_data, result) 2-tuples, where result is the number
+of bytes transferred, or a negated errno value if the operation failed.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_completions_impl(pyIoUring_Object *self)
+/*[clinic end generated code: output=722e050e19cfd86c input=1540936b1a75b07a]*/
+{
+    PyObject *result;
+    Py_buffer *views;
+    Py_ssize_t n, i;
+    unsigned head, tail;
+
+    if (self->ring_fd < 0 || self->closing)
+        return pyiouring_err_closed();
+
+    head = *self->cq_head;
+    tail = __atomic_load_n(self->cq_tail, __ATOMIC_ACQUIRE);
+    n = tail - head;
+    result = PyList_New(n);
+    if (result == NULL) {
+        return NULL;
+    }
+    views = PyMem_New(Py_buffer, n);
+    if (views == NULL && n > 0) {
+        Py_DECREF(result);
+        return PyErr_NoMemory();
+    }
+    /* Build the whole list before consuming anything, so that no completion
+       is lost on error */
+    for (i = 0; i < n; i++) {
+        struct io_uring_cqe *cqe = &self->cqes[(head + i) & self->cq_mask];
+        PyObject *item = Py_BuildValue(
+            "Ki", self->ops[cqe->user_data].user_data, cqe->res);
+        if (item == NULL) {
+            PyMem_Free(views);
+            Py_DECREF(result);
+            return NULL;
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+    for (i = 0; i < n; i++) {
+        struct io_uring_cqe *cqe = &self->cqes[(head + i) & self->cq_mask];
+        pyiouring_free_op(self, (Py_ssize_t)cqe->user_data, &views[i]);
+    }
+    __atomic_store_n(self->cq_head, tail, __ATOMIC_RELEASE);
+    /* Releasing a buffer may run arbitrary code: only do it once the
+       completion ring is consistent */
+    for (i = 0; i < n; i++) {
+        PyBuffer_Release(&views[i]);
+    }
+    PyMem_Free(views);
+    return result;
+}
+
+/*[clinic input]
+select.io_uring.register_buffers
+
+    buffers: object
+      a sequence of writable bytes-like objects
+    /
+
+Register buffers for read_fixed() and write_fixed().
+
+The kernel maps registered buffers once, instead of on every operation.
+They stay exported until unregister_buffers() or close() is called.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_register_buffers(pyIoUring_Object *self, PyObject *buffers)
+/*[clinic end generated code: output=6948cbceb21ada4a input=c764a732f249d502]*/
+{
+    PyObject *seq;
+    Py_buffer *views = NULL;
+    struct iovec *iov = NULL;
+    Py_ssize_t n, i, got = 0;
+    int fd, ret;
+
+    if (self->ring_fd < 0 || self->closing)
+        return pyiouring_err_closed();
+    if (self->fixed != NULL) {
+        return pyiouring_err_busy();
+    }
+
+    seq = PySequence_Fast(buffers, "buffers must be a sequence");
+    if (seq == NULL) {
+        return NULL;
+    }
+    n = PySequence_Fast_GET_SIZE(seq);
+    if (n == 0 || n > UINT16_MAX) {
+        PyErr_SetString(PyExc_ValueError, "invalid number of buffers");
+        goto error;
+    }
+    views = PyMem_New(Py_buffer, n);
+    iov = PyMem_New(struct iovec, n);
+    if (views == NULL || iov == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    for (got = 0; got < n; got++) {
+        PyObject *item = PySequence_Fast_GET_ITEM(seq, got);
+        if (PyObject_GetBuffer(item, &views[got], PyBUF_WRITABLE) < 0) {
+            goto error;
+        }
+        iov[got].iov_base = views[got].buf;
+        iov[got].iov_len = views[got].len;
+    }
+
+    fd = self->ring_fd;
+    Py_BEGIN_ALLOW_THREADS
+    ret = (int)syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS,
+                       iov, (unsigned)n);
+    Py_END_ALLOW_THREADS
+    if (ret < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        goto error;
+    }
+    if (self->ring_fd < 0 || self->closing || self->fixed != NULL) {
+        /* Raced with close() or with another registration */
+        pyiouring_err_busy();
+        goto error;
+    }
+    self->fixed = views;
+    self->nfixed = n;
+    PyMem_Free(iov);
+    Py_DECREF(seq);
+    Py_RETURN_NONE;
+
+error:
+    for (i = 0; i < got; i++) {
+        PyBuffer_Release(&views[i]);
+    }
+    PyMem_Free(views);
+    PyMem_Free(iov);
+    Py_DECREF(seq);
+    return NULL;
+}
+
+/*[clinic input]
+select.io_uring.unregister_buffers
+
+Unregister the buffers registered by register_buffers().
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_unregister_buffers_impl(pyIoUring_Object *self)
+/*[clinic end generated code: output=500e5b1d9952d571 input=1142145a0448d826]*/
+{
+    Py_buffer *fixed;
+    Py_ssize_t nfixed, i;
+    int fd, ret;
+
+    if (self->ring_fd < 0 || self->closing)
+        return pyiouring_err_closed();
+    if (self->fixed == NULL) {
+        errno = ENXIO;
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+    if (self->fixed_inflight) {
+        return pyiouring_err_busy();
+    }
+
+    fd = self->ring_fd;
+    ret = (int)syscall(__NR_io_uring_register, fd, IORING_UNREGISTER_BUFFERS,
+                       NULL, 0);
+    if (ret < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+    fixed = self->fixed;
+    nfixed = self->nfixed;
+    self->fixed = NULL;
+    self->nfixed = 0;
+    for (i = 0; i < nfixed; i++) {
+        PyBuffer_Release(&fixed[i]);
+    }
+    PyMem_Free(fixed);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+select.io_uring.register_eventfd
+
+    fd: fildes
+      an eventfd file descriptor, see os.eventfd()
+    /
+
+Signal the eventfd whenever an operation completes.
+
+This lets an event loop wait for completions along with its other file
+descriptors.
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_register_eventfd_impl(pyIoUring_Object *self, int fd)
+/*[clinic end generated code: output=0175e936be155767 input=aac96a90714ead24]*/
+{
+    if (self->ring_fd < 0 || self->closing)
+        return pyiouring_err_closed();
+    if (syscall(__NR_io_uring_register, self->ring_fd,
+                IORING_REGISTER_EVENTFD, &fd, 1) < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+select.io_uring.unregister_eventfd
+
+Stop signalling the eventfd registered by register_eventfd().
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring_unregister_eventfd_impl(pyIoUring_Object *self)
+/*[clinic end generated code: output=c950da7461dfebcc input=9fc1d8c891a42ebe]*/
+{
+    if (self->ring_fd < 0 || self->closing)
+        return pyiouring_err_closed();
+    if (syscall(__NR_io_uring_register, self->ring_fd,
+                IORING_UNREGISTER_EVENTFD, NULL, 0) < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+select.io_uring.__enter__
+
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring___enter___impl(pyIoUring_Object *self)
+/*[clinic end generated code: output=6453f8b2562a22d4 input=8edfa5fe3684ef9a]*/
+{
+    if (self->ring_fd < 0 || self->closing)
+        return pyiouring_err_closed();
+
+    return Py_NewRef(self);
+}
+
+/*[clinic input]
+select.io_uring.__exit__
+
+    exc_type:  object = None
+    exc_value: object = None
+    exc_tb:    object = None
+    /
+
+[clinic start generated code]*/
+
+static PyObject *
+select_io_uring___exit___impl(pyIoUring_Object *self, PyObject *exc_type,
+                              PyObject *exc_value, PyObject *exc_tb)
+/*[clinic end generated code: output=313376fb85210e74 input=1e269333b0d5d167]*/
+{
+    _selectstate *state = _selectstate_by_type(Py_TYPE(self));
+    return PyObject_CallMethodObjArgs((PyObject *)self, state->close, NULL);
+}
+
+static PyGetSetDef pyiouring_getsetlist[] = {
+    {"closed", (getter)pyiouring_get_closed, NULL,
+     "True if the io_uring object is closed"},
+    {0},
+};
+
+#endif /* HAVE_IO_URING */
+
 #ifdef HAVE_KQUEUE
 /* **************************************************************************
  *                      kqueue interface for BSD
@@ -2344,6 +3370,47 @@ static PyType_Spec pyEpoll_Type_spec = {
 
 #endif /* HAVE_EPOLL */
 
+#ifdef HAVE_IO_URING
+
+static PyMethodDef pyiouring_methods[] = {
+    SELECT_IO_URING_CLOSE_METHODDEF
+    SELECT_IO_URING_FILENO_METHODDEF
+    SELECT_IO_URING_READ_METHODDEF
+    SELECT_IO_URING_WRITE_METHODDEF
+    SELECT_IO_URING_READ_FIXED_METHODDEF
+    SELECT_IO_URING_WRITE_FIXED_METHODDEF
+    SELECT_IO_URING_SUBMIT_METHODDEF
+    SELECT_IO_URING_COMPLETIONS_METHODDEF
+    SELECT_IO_URING_REGISTER_BUFFERS_METHODDEF
+    SELECT_IO_URING_UNREGISTER_BUFFERS_METHODDEF
+    SELECT_IO_URING_REGISTER_EVENTFD_METHODDEF
+    SELECT_IO_URING_UNREGISTER_EVENTFD_METHODDEF
+    SELECT_IO_URING___ENTER___METHODDEF
+    SELECT_IO_URING___EXIT___METHODDEF
+    {NULL,      NULL},
+};
+
+static PyType_Slot pyIoUring_Type_slots[] = {
+    {Py_tp_dealloc, pyiouring_dealloc},
+    {Py_tp_doc, (void*)select_io_uring__doc__},
+    {Py_tp_getset, pyiouring_getsetlist},
+    {Py_tp_methods, pyiouring_methods},
+    {Py_tp_new, select_io_uring},
+    {Py_tp_traverse, pyiouring_traverse},
+    {Py_tp_clear, pyiouring_clear},
+    {0, 0},
+};
+
+static PyType_Spec pyIoUring_Type_spec = {
+    "select.io_uring",
+    sizeof(pyIoUring_Object),
+    0,
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    pyIoUring_Type_slots
+};
+
+#endif /* HAVE_IO_URING */
+
 #ifdef HAVE_KQUEUE
 
 static PyMethodDef kqueue_queue_methods[] = {
@@ -2404,6 +3471,7 @@ _select_traverse(PyObject *module, visitproc visit, void *arg)
     Py_VISIT(state->poll_Type);
     Py_VISIT(state->devpoll_Type);
     Py_VISIT(state->pyEpoll_Type);
+    Py_VISIT(state->pyIoUring_Type);
     Py_VISIT(state->kqueue_event_Type);
     Py_VISIT(state->kqueue_queue_Type);
     return 0;
@@ -2418,6 +3486,7 @@ _select_clear(PyObject *module)
     Py_CLEAR(state->poll_Type);
     Py_CLEAR(state->devpoll_Type);
     Py_CLEAR(state->pyEpoll_Type);
+    Py_CLEAR(state->pyIoUring_Type);
     Py_CLEAR(state->kqueue_event_Type);
     Py_CLEAR(state->kqueue_queue_Type);
     return 0;
@@ -2552,6 +3621,22 @@ _select_exec(PyObject *m)
 #endif
 #endif /* HAVE_EPOLL */
 
+#ifdef HAVE_IO_URING
+    state->pyIoUring_Type = (PyTypeObject *)PyType_FromModuleAndSpec(
+        m, &pyIoUring_Type_spec, NULL);
+    if (state->pyIoUring_Type == NULL) {
+        return -1;
+    }
+    if (PyModule_AddType(m, state->pyIoUring_Type) < 0) {
+        return -1;
+    }
+
+    PyModule_AddIntMacro(m, IOSQE_IO_DRAIN);
+    PyModule_AddIntMacro(m, IOSQE_IO_LINK);
+    PyModule_AddIntMacro(m, IOSQE_IO_HARDLINK);
+    PyModule_AddIntMacro(m, IOSQE_ASYNC);
+#endif /* HAVE_IO_URING */
+
 #ifdef HAVE_KQUEUE
     state->kqueue_event_Type = (PyTypeObject *)PyType_FromModuleAndSpec(
         m, &kqueue_event_Type_spec, NULL);
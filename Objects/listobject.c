@@ -2181,6 +2181,165 @@ unsafe_float_compare(PyObject *v, PyObject *w, MergeState *ms)
     return res;
 }
 
+/* Radix sort: lists of at least RADIX_SORT_MIN_SIZE keys that are all
+ * bounded ints or all floats (the keys unsafe_long_compare and
+ * unsafe_float_compare handle) are sorted by an LSD radix sort on an
+ * order-preserving unsigned image of each key, instead of by timsort.
+ * Both sorts are stable and the images order the keys exactly as "<"
+ * does, so the result is the same.  Timsort is kept for inputs that are
+ * mostly in order already, which it handles in close to linear time.
+ */
+#define RADIX_SORT_MIN_SIZE 1024
+
+/* Stable LSD radix sort of n (key, index) pairs, one byte per pass,
+ * skipping the bytes in which all keys agree.  keys and idx have room
+ * for 2*n entries: the upper halves are scratch space.  On return the
+ * sorted pairs are in keys[0:n] and idx[0:n].  Doesn't touch any Python
+ * object, so it may run without the GIL.
+ */
+static void
+radix_sort_pairs(uint64_t *keys, Py_ssize_t *idx, Py_ssize_t n)
+{
+    Py_ssize_t counts[8][256];
+    uint64_t *src_keys = keys, *dst_keys = keys + n;
+    Py_ssize_t *src_idx = idx, *dst_idx = idx + n;
+    Py_ssize_t i;
+
+    /* Count every byte in a single pass over the keys. */
+    memset(counts, 0, sizeof(counts));
+    for (i = 0; i < n; i++) {
+        uint64_t key = keys[i];
+        for (int b = 0; b < 8; b++) {
+            counts[b][(key >> (8 * b)) & 0xff]++;
+        }
+    }
+
+    for (int b = 0; b < 8; b++) {
+        Py_ssize_t *count = counts[b];
+        int shift = 8 * b;
+        if (count[(src_keys[0] >> shift) & 0xff] == n) {
+            /* All keys have the same byte here. */
+            continue;
+        }
+        Py_ssize_t sum = 0;
+        for (int j = 0; j < 256; j++) {
+            Py_ssize_t c = count[j];
+            count[j] = sum;
+            sum += c;
+        }
+        for (i = 0; i < n; i++) {
+            uint64_t key = src_keys[i];
+            Py_ssize_t pos = count[(key >> shift) & 0xff]++;
+            dst_keys[pos] = key;
+            dst_idx[pos] = src_idx[i];
+        }
+        uint64_t *tmp_keys = src_keys;
+        src_keys = dst_keys;
+        dst_keys = tmp_keys;
+        Py_ssize_t *tmp_idx = src_idx;
+        src_idx = dst_idx;
+        dst_idx = tmp_idx;
+    }
+
+    if (src_keys != keys) {
+        memcpy(keys, src_keys, n * sizeof(uint64_t));
+        memcpy(idx, src_idx, n * sizeof(Py_ssize_t));
+    }
+}
+
+/* Sort the n keys of lo (and its values, if any) with radix_sort_pairs().
+ * The keys must all be bounded ints, or all floats if keys_are_floats.
+ * Returns 1 if the slice is now sorted, or 0 if it should be left to
+ * timsort: the keys are mostly in order already, there is a NaN (which
+ * doesn't have a place in the order), or the memory for the radix sort
+ * isn't available.  Never raises.
+ */
+static int
+radix_sort_slice(sortslice *lo, Py_ssize_t n, int keys_are_floats)
+{
+    uint64_t *keys = NULL;
+    Py_ssize_t *idx = NULL;
+    Py_ssize_t i, descents = 0;
+    int result = 0;
+
+    assert(n >= 2);
+    if (n > PY_SSIZE_T_MAX / (Py_ssize_t)(2 * sizeof(uint64_t))) {
+        return 0;
+    }
+    keys = PyMem_Malloc(2 * n * sizeof(uint64_t));
+    idx = PyMem_Malloc(2 * n * sizeof(Py_ssize_t));
+    if (keys == NULL || idx == NULL) {
+        goto done;
+    }
+
+    if (keys_are_floats) {
+        for (i = 0; i < n; i++) {
+            double d = PyFloat_AS_DOUBLE(lo->keys[i]);
+            uint64_t u;
+            if (Py_IS_NAN(d)) {
+                goto done;
+            }
+            if (d == 0.0) {
+                d = 0.0;  /* -0.0 == 0.0 */
+            }
+            memcpy(&u, &d, sizeof(u));
+            /* Flip all bits of negative floats, and only the sign bit of
+               the others: the images then compare like the floats. */
+            u = (u >> 63) ? ~u : (u | ((uint64_t)1 << 63));
+            keys[i] = u;
+            descents += (i > 0 && u < keys[i-1]);
+        }
+    }
+    else {
+        Py_ssize_t min = PY_SSIZE_T_MAX;
+        for (i = 0; i < n; i++) {
+            Py_ssize_t v = _PyLong_CompactValue((PyLongObject *)lo->keys[i]);
+            keys[i] = (uint64_t)v;
+            descents += (i > 0 && v < (Py_ssize_t)keys[i-1]);
+            min = Py_MIN(min, v);
+        }
+        /* Offset the values by the minimum, so that the high bytes of
+           small ints are zero and the passes over them are skipped. */
+        for (i = 0; i < n; i++) {
+            keys[i] -= (uint64_t)min;
+        }
+    }
+
+    if (descents == 0) {
+        /* Already sorted. */
+        result = 1;
+        goto done;
+    }
+    if (descents < n / 32) {
+        goto done;
+    }
+
+    for (i = 0; i < n; i++) {
+        idx[i] = i;
+    }
+    radix_sort_pairs(keys, idx, n);
+
+    /* Apply the permutation, reusing the key buffer, which is no longer
+       needed, to hold the reordered pointers. */
+    PyObject **tmp = (PyObject **)keys;
+    for (i = 0; i < n; i++) {
+        tmp[i] = lo->keys[idx[i]];
+    }
+    memcpy(lo->keys, tmp, n * sizeof(PyObject *));
+    if (lo->values != NULL) {
+        for (i = 0; i < n; i++) {
+            tmp[i] = lo->values[idx[i]];
+        }
+        memcpy(lo->values, tmp, n * sizeof(PyObject *));
+    }
+    result = 1;
+
+done:
+    PyMem_Free(keys);
+    PyMem_Free(idx);
+    return result;
+}
+
 /* Tuple compare: compare *any* two tuples, using
  * ms->tuple_elem_compare to compare the first elements, which is set
  * using the same pre-sort check as we use for ms->key_compare,
@@ -2422,6 +2581,15 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         reverse_slice(&saved_ob_item[0], &saved_ob_item[saved_ob_size]);
     }
 
+    if (nremaining >= RADIX_SORT_MIN_SIZE &&
+        (ms.key_compare == unsafe_long_compare ||
+         ms.key_compare == unsafe_float_compare) &&
+        radix_sort_slice(&lo, nremaining,
+                         ms.key_compare == unsafe_float_compare))
+    {
+        goto succeed;
+    }
+
     /* March over the array once, left to right, finding natural runs,
      * and extending short natural runs to minrun elements.
      */
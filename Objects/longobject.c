@@ -37,7 +37,7 @@ static inline void
 _Py_DECREF_INT(PyLongObject *op)
 {
     assert(PyLong_CheckExact(op));
-    _Py_DECREF_SPECIALIZED((PyObject *)op, (destructor)PyObject_Free);
+    _Py_DECREF_SPECIALIZED((PyObject *)op, _PyLong_ExactDealloc);
 }
 
 static inline int
@@ -138,6 +138,34 @@ long_normalize(PyLongObject *v)
 #define MAX_LONG_DIGITS \
     ((PY_SSIZE_T_MAX - offsetof(PyLongObject, long_value.ob_digit))/sizeof(digit))
 
+#if PyLong_MAXFREELIST > 0
+static struct _Py_long_state *
+get_long_state(void)
+{
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    return &interp->long_state;
+}
+
+/* Take a block big enough for a single-digit int from the free list,
+   or return NULL if the free list is empty. */
+static inline PyLongObject *
+long_freelist_pop(void)
+{
+    struct _Py_long_state *state = get_long_state();
+    PyLongObject *op = state->free_list;
+    if (op != NULL) {
+#ifdef Py_DEBUG
+        // ints must not be created after _PyLong_Fini()
+        assert(state->numfree != -1);
+#endif
+        state->free_list = (PyLongObject *) Py_TYPE(op);
+        state->numfree--;
+        OBJECT_STAT_INC(from_freelist);
+    }
+    return op;
+}
+#endif
+
 PyLongObject *
 _PyLong_New(Py_ssize_t size)
 {
@@ -151,6 +179,13 @@ _PyLong_New(Py_ssize_t size)
     /* Fast operations for single digit integers (including zero)
      * assume that there is always at least one digit present. */
     Py_ssize_t ndigits = size ? size : 1;
+#if PyLong_MAXFREELIST > 0
+    if (ndigits == 1 && (result = long_freelist_pop()) != NULL) {
+        _PyLong_SetSignAndDigitCount(result, size != 0, size);
+        _PyObject_Init((PyObject*)result, &PyLong_Type);
+        return result;
+    }
+#endif
     /* Number of bytes needed is: offsetof(PyLongObject, ob_digit) +
        sizeof(digit)*size.  Previous incarnations of this code used
        sizeof() instead of the offsetof, but this risks being
@@ -204,11 +239,16 @@ _PyLong_FromMedium(sdigit x)
 {
     assert(!IS_SMALL_INT(x));
     assert(is_medium_int(x));
-    /* We could use a freelist here */
-    PyLongObject *v = PyObject_Malloc(sizeof(PyLongObject));
+    PyLongObject *v = NULL;
+#if PyLong_MAXFREELIST > 0
+    v = long_freelist_pop();
+#endif
     if (v == NULL) {
-        PyErr_NoMemory();
-        return NULL;
+        v = PyObject_Malloc(sizeof(PyLongObject));
+        if (v == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
     }
     digit abs_x = x < 0 ? -x : x;
     _PyLong_SetSignAndDigitCount(v, x<0?-1:1, 1);
@@ -3270,6 +3310,31 @@ long_richcompare(PyObject *self, PyObject *other, int op)
     Py_RETURN_RICHCOMPARE(result, 0, op);
 }
 
+void
+_PyLong_ExactDealloc(PyObject *self)
+{
+    assert(PyLong_CheckExact(self));
+#if PyLong_MAXFREELIST > 0
+    /* Every int block holds at least one digit, so any compact int can
+       be reused for a single-digit value. */
+    if (_PyLong_IsCompact((PyLongObject *)self)) {
+        struct _Py_long_state *state = get_long_state();
+#ifdef Py_DEBUG
+        // long_dealloc() must not be called after _PyLong_Fini()
+        assert(state->numfree != -1);
+#endif
+        if (state->numfree < PyLong_MAXFREELIST) {
+            state->numfree++;
+            Py_SET_TYPE(self, (PyTypeObject *)state->free_list);
+            state->free_list = (PyLongObject *)self;
+            OBJECT_STAT_INC(to_freelist);
+            return;
+        }
+    }
+#endif
+    PyObject_Free(self);
+}
+
 static void
 long_dealloc(PyObject *self)
 {
@@ -3288,7 +3353,12 @@ long_dealloc(PyObject *self)
             }
         }
     }
-    Py_TYPE(self)->tp_free(self);
+    if (PyLong_CheckExact(self)) {
+        _PyLong_ExactDealloc(self);
+    }
+    else {
+        Py_TYPE(self)->tp_free(self);
+    }
 }
 
 static Py_hash_t
@@ -3927,6 +3997,30 @@ k_lopsided_mul(PyLongObject *a, PyLongObject *b)
     return NULL;
 }
 
+#ifdef WITH_PYLONG_MODULE
+/* asymptotically faster multiplication, using _pylong.py */
+static PyObject *
+pylong_int_mul(PyLongObject *a, PyLongObject *b)
+{
+    PyObject *mod = PyImport_ImportModule("_pylong");
+    if (mod == NULL) {
+        return NULL;
+    }
+    PyObject *result = PyObject_CallMethod(mod, "int_mul", "OO", a, b);
+    Py_DECREF(mod);
+    if (result == NULL) {
+        return NULL;
+    }
+    if (!PyLong_Check(result)) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_TypeError,
+                        "_pylong.int_mul did not return an int");
+        return NULL;
+    }
+    return result;
+}
+#endif /* WITH_PYLONG_MODULE */
+
 PyObject *
 _PyLong_Multiply(PyLongObject *a, PyLongObject *b)
 {
@@ -3938,6 +4032,19 @@ _PyLong_Multiply(PyLongObject *a, PyLongObject *b)
         return _PyLong_FromSTwoDigits(v);
     }
 
+#if WITH_PYLONG_MODULE
+    Py_ssize_t size_a = _PyLong_DigitCount(a);
+    Py_ssize_t size_b = _PyLong_DigitCount(b);
+    if (size_a > 2000 && size_b > 2000 &&
+        size_a <= 2 * size_b && size_b <= 2 * size_a) {
+        /* Switch to _pylong.int_mul(), which uses Toom-3 on top of
+           k_mul().  Lopsided products are left to k_lopsided_mul(), which
+           cuts them into balanced pieces.  The limit is empirically
+           determined and is slightly conservative, like the ones for
+           divmod and str(). */
+        return pylong_int_mul(a, b);
+    }
+#endif
     z = k_mul(a, b);
     /* Negate if exactly one of the inputs is negative. */
     if (!_PyLong_SameSign(a, b) && z) {
@@ -4164,22 +4271,27 @@ l_mod(PyLongObject *v, PyLongObject *w, PyLongObject **pmod)
     return 0;
 }
 
-static PyObject *
-long_div(PyObject *a, PyObject *b)
+PyObject *
+_PyLong_FloorDivide(PyLongObject *a, PyLongObject *b)
 {
     PyLongObject *div;
 
-    CHECK_BINOP(a, b);
-
-    if (_PyLong_DigitCount((PyLongObject*)a) == 1 && _PyLong_DigitCount((PyLongObject*)b) == 1) {
-        return fast_floor_div((PyLongObject*)a, (PyLongObject*)b);
+    if (_PyLong_DigitCount(a) == 1 && _PyLong_DigitCount(b) == 1) {
+        return fast_floor_div(a, b);
     }
 
-    if (l_divmod((PyLongObject*)a, (PyLongObject*)b, &div, NULL) < 0)
+    if (l_divmod(a, b, &div, NULL) < 0)
         div = NULL;
     return (PyObject *)div;
 }
 
+static PyObject *
+long_div(PyObject *a, PyObject *b)
+{
+    CHECK_BINOP(a, b);
+    return _PyLong_FloorDivide((PyLongObject*)a, (PyLongObject*)b);
+}
+
 /* PyLong/PyLong -> float, with correctly rounded result. */
 
 #define MANT_DIG_DIGITS (DBL_MANT_DIG / PyLong_SHIFT)
@@ -4442,18 +4554,23 @@ long_true_divide(PyObject *v, PyObject *w)
     return NULL;
 }
 
-static PyObject *
-long_mod(PyObject *a, PyObject *b)
+PyObject *
+_PyLong_Remainder(PyLongObject *a, PyLongObject *b)
 {
     PyLongObject *mod;
 
-    CHECK_BINOP(a, b);
-
-    if (l_mod((PyLongObject*)a, (PyLongObject*)b, &mod) < 0)
+    if (l_mod(a, b, &mod) < 0)
         mod = NULL;
     return (PyObject *)mod;
 }
 
+static PyObject *
+long_mod(PyObject *a, PyObject *b)
+{
+    CHECK_BINOP(a, b);
+    return _PyLong_Remainder((PyLongObject*)a, (PyLongObject*)b);
+}
+
 static PyObject *
 long_divmod(PyObject *a, PyObject *b)
 {
@@ -5268,18 +5385,22 @@ long_bitwise(PyLongObject *a,
     return (PyObject *)maybe_small_long(long_normalize(z));
 }
 
-static PyObject *
-long_and(PyObject *a, PyObject *b)
+PyObject *
+_PyLong_And(PyLongObject *x, PyLongObject *y)
 {
-    CHECK_BINOP(a, b);
-    PyLongObject *x = (PyLongObject*)a;
-    PyLongObject *y = (PyLongObject*)b;
     if (_PyLong_IsCompact(x) && _PyLong_IsCompact(y)) {
         return _PyLong_FromSTwoDigits(medium_value(x) & medium_value(y));
     }
     return long_bitwise(x, '&', y);
 }
 
+static PyObject *
+long_and(PyObject *a, PyObject *b)
+{
+    CHECK_BINOP(a, b);
+    return _PyLong_And((PyLongObject*)a, (PyLongObject*)b);
+}
+
 static PyObject *
 long_xor(PyObject *a, PyObject *b)
 {
@@ -6369,3 +6490,41 @@ _PyLong_FiniTypes(PyInterpreterState *interp)
 
     _PyStructSequence_FiniType(&Int_InfoType);
 }
+
+void
+_PyLong_ClearFreeList(PyInterpreterState *interp)
+{
+#if PyLong_MAXFREELIST > 0
+    struct _Py_long_state *state = &interp->long_state;
+    PyLongObject *op = state->free_list;
+    while (op != NULL) {
+        PyLongObject *next = (PyLongObject *) Py_TYPE(op);
+        PyObject_Free(op);
+        op = next;
+    }
+    state->free_list = NULL;
+    state->numfree = 0;
+#endif
+}
+
+void
+_PyLong_Fini(PyInterpreterState *interp)
+{
+    _PyLong_ClearFreeList(interp);
+#if defined(Py_DEBUG) && PyLong_MAXFREELIST > 0
+    struct _Py_long_state *state = &interp->long_state;
+    state->numfree = -1;
+#endif
+}
+
+/* Print summary info about the state of the optimized allocator */
+void
+_PyLong_DebugMallocStats(FILE *out)
+{
+#if PyLong_MAXFREELIST > 0
+    struct _Py_long_state *state = get_long_state();
+    _PyDebugAllocatorStats(out,
+                           "free PyLongObject",
+                           state->numfree, sizeof(PyLongObject));
+#endif
+}
@@ -1481,6 +1481,26 @@ set_copy_and_difference(PySetObject *so, PyObject *other)
     return NULL;
 }
 
+/* set_difference() sizes the table of its result for len(so) elements up
+   front when so has at least this many elements, instead of growing it
+   several times. */
+#define SET_DIFFERENCE_PRESIZE_MIN 50000
+
+/* Shrink the table of a presized set_difference() result if most of the
+   elements were dropped. */
+static PyObject *
+set_difference_done(PyObject *result, int presized)
+{
+    PySetObject *so = (PySetObject *)result;
+    if (presized && (size_t)so->used * 5 < (size_t)so->mask &&
+        set_table_resize(so, so->used>50000 ? so->used*2 : so->used*4))
+    {
+        Py_DECREF(result);
+        return NULL;
+    }
+    return result;
+}
+
 static PyObject *
 set_difference(PySetObject *so, PyObject *other)
 {
@@ -1489,7 +1509,7 @@ set_difference(PySetObject *so, PyObject *other)
     Py_hash_t hash;
     setentry *entry;
     Py_ssize_t pos = 0, other_size;
-    int rv;
+    int rv, presized;
 
     if (PyAnySet_Check(other)) {
         other_size = PySet_GET_SIZE(other);
@@ -1510,6 +1530,14 @@ set_difference(PySetObject *so, PyObject *other)
     result = make_new_set_basetype(Py_TYPE(so), NULL);
     if (result == NULL)
         return NULL;
+    /* The result has at most len(so) elements. */
+    presized = PySet_GET_SIZE(so) >= SET_DIFFERENCE_PRESIZE_MIN;
+    if (presized &&
+        set_table_resize((PySetObject *)result, PySet_GET_SIZE(so) * 2))
+    {
+        Py_DECREF(result);
+        return NULL;
+    }
 
     if (PyDict_CheckExact(other)) {
         while (set_next(so, &pos, &entry)) {
@@ -1531,7 +1559,7 @@ set_difference(PySetObject *so, PyObject *other)
             }
             Py_DECREF(key);
         }
-        return result;
+        return set_difference_done(result, presized);
     }
 
     /* Iterate over so, checking for common elements in other. */
@@ -1554,7 +1582,7 @@ set_difference(PySetObject *so, PyObject *other)
         }
         Py_DECREF(key);
     }
-    return result;
+    return set_difference_done(result, presized);
 }
 
 static PyObject *
@@ -1547,11 +1547,30 @@ unicode_dealloc(PyObject *unicode)
         _Py_FatalRefcountError("deallocating an Unicode singleton");
     }
 #endif
-    /* This should never get called, but we also don't want to SEGV if
-     * we accidentally decref an immortal string out of existence. Since
-     * the string is an immortal object, just re-set the reference count.
-     */
-    if (PyUnicode_CHECK_INTERNED(unicode)) {
+    switch (PyUnicode_CHECK_INTERNED(unicode)) {
+    case SSTATE_NOT_INTERNED:
+        break;
+    case SSTATE_INTERNED_MORTAL:
+    {
+        /* Remove the object from the intern dict.
+         * Before doing so, we set the refcount to 3: the key and value
+         * in the interned dict count as references, and the third
+         * is the reference from the dealloc caller. */
+        PyObject *interned = get_interned_dict(_PyInterpreterState_GET());
+        Py_SET_REFCNT(unicode, 3);
+        if (PyDict_DelItem(interned, unicode) != 0) {
+            _PyErr_WriteUnraisableMsg("deletion of interned string failed",
+                                      NULL);
+        }
+        assert(Py_REFCNT(unicode) == 1);
+        Py_SET_REFCNT(unicode, 0);
+        break;
+    }
+    default:
+        /* This should never get called, but we also don't want to SEGV if
+         * we accidentally decref an immortal string out of existence. Since
+         * the string is an immortal object, just re-set the reference count.
+         */
         _Py_SetImmortal(unicode);
         return;
     }
@@ -3695,6 +3714,20 @@ PyUnicode_AsUTF8(PyObject *unicode)
     return PyUnicode_AsUTF8AndSize(unicode, NULL);
 }
 
+/* Return the UTF-8 representation of a string if it is already available,
+   either as the data of a compact ASCII string or as the cached UTF-8
+   buffer. Return NULL without computing it otherwise; never raise. */
+const char *
+_PyUnicode_GetCachedUTF8(PyObject *unicode, Py_ssize_t *psize)
+{
+    assert(PyUnicode_Check(unicode));
+    const char *utf8 = PyUnicode_UTF8(unicode);
+    if (utf8 != NULL && psize != NULL) {
+        *psize = PyUnicode_UTF8_LENGTH(unicode);
+    }
+    return utf8;
+}
+
 /*
 PyUnicode_GetSize() has been deprecated since Python 3.3
 because it returned length of Py_UNICODE.
@@ -14589,8 +14622,8 @@ _PyUnicode_InitTypes(PyInterpreterState *interp)
 }
 
 
-void
-_PyUnicode_InternInPlace(PyInterpreterState *interp, PyObject **p)
+static void
+intern_common(PyInterpreterState *interp, PyObject **p, int immortalize)
 {
     PyObject *s = *p;
 #ifdef Py_DEBUG
@@ -14608,7 +14641,18 @@ _PyUnicode_InternInPlace(PyInterpreterState *interp, PyObject **p)
         return;
     }
 
-    if (PyUnicode_CHECK_INTERNED(s)) {
+    switch (PyUnicode_CHECK_INTERNED(s)) {
+    case SSTATE_NOT_INTERNED:
+        break;
+    case SSTATE_INTERNED_MORTAL:
+        if (!immortalize) {
+            return;
+        }
+        /* Promote the string: restore the two references (key and value)
+           held by the interned dict, then make it immortal below. */
+        Py_SET_REFCNT(s, Py_REFCNT(s) + 2);
+        goto immortalize;
+    default:
         return;
     }
 
@@ -14623,6 +14667,15 @@ _PyUnicode_InternInPlace(PyInterpreterState *interp, PyObject **p)
 
     if (t != s) {
         Py_SETREF(*p, Py_NewRef(t));
+        if (immortalize
+            && PyUnicode_CHECK_INTERNED(t) == SSTATE_INTERNED_MORTAL)
+        {
+            /* An equal string was interned mortal by sys.intern():
+               promote it like in the SSTATE_INTERNED_MORTAL case above. */
+            s = t;
+            Py_SET_REFCNT(s, Py_REFCNT(s) + 2);
+            goto immortalize;
+        }
         return;
     }
 
@@ -14630,6 +14683,15 @@ _PyUnicode_InternInPlace(PyInterpreterState *interp, PyObject **p)
         _PyUnicode_STATE(*p).interned = SSTATE_INTERNED_IMMORTAL_STATIC;
        return;
     }
+    if (!immortalize) {
+        /* The two references in the interned dict (key and value) are not
+           counted by refcnt, so the string stays mortal.  unicode_dealloc()
+           and _PyUnicode_ClearInterned() take care of this. */
+        Py_SET_REFCNT(s, Py_REFCNT(s) - 2);
+        _PyUnicode_STATE(s).interned = SSTATE_INTERNED_MORTAL;
+        return;
+    }
+immortalize:
 #ifdef Py_REF_DEBUG
     /* The reference count value excluding the 2 references from the
        interned dictionary should be excluded from the RefTotal. The
@@ -14643,6 +14705,18 @@ _PyUnicode_InternInPlace(PyInterpreterState *interp, PyObject **p)
     _PyUnicode_STATE(*p).interned = SSTATE_INTERNED_IMMORTAL;
 }
 
+void
+_PyUnicode_InternInPlace(PyInterpreterState *interp, PyObject **p)
+{
+    intern_common(interp, p, 1);
+}
+
+void
+_PyUnicode_InternMortal(PyInterpreterState *interp, PyObject **p)
+{
+    intern_common(interp, p, 0);
+}
+
 void
 PyUnicode_InternInPlace(PyObject **p)
 {
@@ -14680,6 +14754,18 @@ _PyUnicode_ClearInterned(PyInterpreterState *interp)
     }
     assert(PyDict_CheckExact(interned));
 
+    /* Restore the two references (key and value) to mortal interned strings
+       ignored by _PyUnicode_InternMortal(), so that clearing the dict below
+       leaves them with their real reference count. */
+    Py_ssize_t pos = 0;
+    PyObject *s, *ignored_value;
+    while (PyDict_Next(interned, &pos, &s, &ignored_value)) {
+        if (PyUnicode_CHECK_INTERNED(s) == SSTATE_INTERNED_MORTAL) {
+            Py_SET_REFCNT(s, Py_REFCNT(s) + 2);
+            _PyUnicode_STATE(s).interned = SSTATE_NOT_INTERNED;
+        }
+    }
+
     /* TODO:
      * Currently, the runtime is not able to guarantee that it can exit without
      * allocations that carry over to a future initialization of Python within
@@ -14700,8 +14786,7 @@ _PyUnicode_ClearInterned(PyInterpreterState *interp)
 
     Py_ssize_t total_length = 0;
 #endif
-    Py_ssize_t pos = 0;
-    PyObject *s, *ignored_value;
+    pos = 0;
     while (PyDict_Next(interned, &pos, &s, &ignored_value)) {
         assert(PyUnicode_IS_READY(s));
         switch (PyUnicode_CHECK_INTERNED(s)) {
@@ -14716,9 +14801,10 @@ _PyUnicode_ClearInterned(PyInterpreterState *interp)
             break;
         case SSTATE_INTERNED_IMMORTAL_STATIC:
             break;
-        case SSTATE_INTERNED_MORTAL:
-            /* fall through */
         case SSTATE_NOT_INTERNED:
+            /* Mortal string already released above */
+            continue;
+        case SSTATE_INTERNED_MORTAL:
             /* fall through */
         default:
             Py_UNREACHABLE();
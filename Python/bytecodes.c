@@ -277,11 +277,17 @@ dummy_func(
             BINARY_OP_ADD_FLOAT,
             BINARY_OP_ADD_INT,
             BINARY_OP_ADD_UNICODE,
+            BINARY_OP_AND_INT,
+            BINARY_OP_FLOOR_DIVIDE_INT,
             // BINARY_OP_INPLACE_ADD_UNICODE,  // This is an odd duck.
+            BINARY_OP_LSHIFT_INT,
             BINARY_OP_MULTIPLY_FLOAT,
+            BINARY_OP_MULTIPLY_FLOAT_INT,
             BINARY_OP_MULTIPLY_INT,
+            BINARY_OP_REMAINDER_INT,
             BINARY_OP_SUBTRACT_FLOAT,
             BINARY_OP_SUBTRACT_INT,
+            BINARY_OP_TRUE_DIVIDE_FLOAT,
         };
 
 
@@ -290,8 +296,8 @@ dummy_func(
             DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
             STAT_INC(BINARY_OP, hit);
             prod = _PyLong_Multiply((PyLongObject *)left, (PyLongObject *)right);
-            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
-            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(right, _PyLong_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyLong_ExactDealloc);
             ERROR_IF(prod == NULL, error);
         }
 
@@ -309,8 +315,8 @@ dummy_func(
             DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
             STAT_INC(BINARY_OP, hit);
             sub = _PyLong_Subtract((PyLongObject *)left, (PyLongObject *)right);
-            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
-            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(right, _PyLong_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyLong_ExactDealloc);
             ERROR_IF(sub == NULL, error);
         }
 
@@ -322,12 +328,97 @@ dummy_func(
             DECREF_INPUTS_AND_REUSE_FLOAT(left, right, dsub, sub);
         }
 
+        inst(BINARY_OP_MULTIPLY_FLOAT_INT, (unused/1, left, right -- prod)) {
+            /* float * int or int * float, where the int is compact and
+             * therefore exactly representable as a double. */
+            PyObject *flt = PyFloat_CheckExact(left) ? left : right;
+            PyObject *num = flt == left ? right : left;
+            DEOPT_IF(!PyFloat_CheckExact(flt), BINARY_OP);
+            DEOPT_IF(!PyLong_CheckExact(num), BINARY_OP);
+            DEOPT_IF(!_PyLong_IsCompact((PyLongObject *)num), BINARY_OP);
+            STAT_INC(BINARY_OP, hit);
+            double dprod = ((PyFloatObject *)flt)->ob_fval *
+                (double)_PyLong_CompactValue((PyLongObject *)num);
+            if (Py_REFCNT(flt) == 1) {
+                ((PyFloatObject *)flt)->ob_fval = dprod;
+                prod = flt;
+            }
+            else {
+                prod = PyFloat_FromDouble(dprod);
+                if (prod == NULL) goto error;
+                _Py_DECREF_NO_DEALLOC(flt);
+            }
+            _Py_DECREF_SPECIALIZED(num, _PyLong_ExactDealloc);
+        }
+
+        inst(BINARY_OP_TRUE_DIVIDE_FLOAT, (unused/1, left, right -- quot)) {
+            DEOPT_IF(!PyFloat_CheckExact(left), BINARY_OP);
+            DEOPT_IF(!PyFloat_CheckExact(right), BINARY_OP);
+            /* Leave raising ZeroDivisionError to the generic path. */
+            DEOPT_IF(((PyFloatObject *)right)->ob_fval == 0.0, BINARY_OP);
+            STAT_INC(BINARY_OP, hit);
+            double dquot = ((PyFloatObject *)left)->ob_fval /
+                ((PyFloatObject *)right)->ob_fval;
+            DECREF_INPUTS_AND_REUSE_FLOAT(left, right, dquot, quot);
+        }
+
+        inst(BINARY_OP_FLOOR_DIVIDE_INT, (unused/1, left, right -- res)) {
+            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
+            DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+            DEOPT_IF(_PyLong_IsZero((PyLongObject *)right), BINARY_OP);
+            STAT_INC(BINARY_OP, hit);
+            res = _PyLong_FloorDivide((PyLongObject *)left, (PyLongObject *)right);
+            _Py_DECREF_SPECIALIZED(right, _PyLong_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyLong_ExactDealloc);
+            ERROR_IF(res == NULL, error);
+        }
+
+        inst(BINARY_OP_REMAINDER_INT, (unused/1, left, right -- res)) {
+            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
+            DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+            DEOPT_IF(_PyLong_IsZero((PyLongObject *)right), BINARY_OP);
+            STAT_INC(BINARY_OP, hit);
+            res = _PyLong_Remainder((PyLongObject *)left, (PyLongObject *)right);
+            _Py_DECREF_SPECIALIZED(right, _PyLong_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyLong_ExactDealloc);
+            ERROR_IF(res == NULL, error);
+        }
+
+        inst(BINARY_OP_AND_INT, (unused/1, left, right -- res)) {
+            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
+            DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+            STAT_INC(BINARY_OP, hit);
+            res = _PyLong_And((PyLongObject *)left, (PyLongObject *)right);
+            _Py_DECREF_SPECIALIZED(right, _PyLong_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyLong_ExactDealloc);
+            ERROR_IF(res == NULL, error);
+        }
+
+        inst(BINARY_OP_LSHIFT_INT, (unused/1, left, right -- res)) {
+            DEOPT_IF(!PyLong_CheckExact(left), BINARY_OP);
+            DEOPT_IF(!PyLong_CheckExact(right), BINARY_OP);
+            /* Negative and huge shift counts take the generic path. */
+            DEOPT_IF(!_PyLong_IsNonNegativeCompact((PyLongObject *)right), BINARY_OP);
+            STAT_INC(BINARY_OP, hit);
+            size_t shift = (size_t)_PyLong_CompactValue((PyLongObject *)right);
+            res = _PyLong_Lshift(left, shift);
+            _Py_DECREF_SPECIALIZED(right, _PyLong_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyLong_ExactDealloc);
+            ERROR_IF(res == NULL, error);
+        }
+
         inst(BINARY_OP_ADD_UNICODE, (unused/1, left, right -- res)) {
             DEOPT_IF(!PyUnicode_CheckExact(left), BINARY_OP);
             DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
             STAT_INC(BINARY_OP, hit);
-            res = PyUnicode_Concat(left, right);
-            _Py_DECREF_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            /* If `left` is only referenced from the stack, as with the
+             * intermediate results of `a + b + c`, PyUnicode_Append
+             * extends it in place instead of copying it into a new
+             * string. Otherwise it behaves like PyUnicode_Concat.
+             * PyUnicode_Append consumes the reference to `left`.
+             */
+            res = left;
+            PyUnicode_Append(&res, right);
             _Py_DECREF_SPECIALIZED(right, _PyUnicode_ExactDealloc);
             ERROR_IF(res == NULL, error);
         }
@@ -381,8 +472,8 @@ dummy_func(
             DEOPT_IF(Py_TYPE(right) != Py_TYPE(left), BINARY_OP);
             STAT_INC(BINARY_OP, hit);
             sum = _PyLong_Add((PyLongObject *)left, (PyLongObject *)right);
-            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
-            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(right, _PyLong_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(left, _PyLong_ExactDealloc);
             ERROR_IF(sum == NULL, error);
         }
 
@@ -452,7 +543,7 @@ dummy_func(
             res = PyList_GET_ITEM(list, index);
             assert(res != NULL);
             Py_INCREF(res);
-            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(sub, _PyLong_ExactDealloc);
             Py_DECREF(list);
         }
 
@@ -468,7 +559,7 @@ dummy_func(
             res = PyTuple_GET_ITEM(tuple, index);
             assert(res != NULL);
             Py_INCREF(res);
-            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(sub, _PyLong_ExactDealloc);
             Py_DECREF(tuple);
         }
 
@@ -563,7 +654,7 @@ dummy_func(
             PyList_SET_ITEM(list, index, value);
             assert(old_value != NULL);
             Py_DECREF(old_value);
-            _Py_DECREF_SPECIALIZED(sub, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(sub, _PyLong_ExactDealloc);
             Py_DECREF(list);
         }
 
@@ -1927,8 +2018,8 @@ dummy_func(
             Py_ssize_t iright = _PyLong_CompactValue((PyLongObject *)right);
             // 2 if <, 4 if >, 8 if ==; this matches the low 4 bits of the oparg
             int sign_ish = COMPARISON_BIT(ileft, iright);
-            _Py_DECREF_SPECIALIZED(left, (destructor)PyObject_Free);
-            _Py_DECREF_SPECIALIZED(right, (destructor)PyObject_Free);
+            _Py_DECREF_SPECIALIZED(left, _PyLong_ExactDealloc);
+            _Py_DECREF_SPECIALIZED(right, _PyLong_ExactDealloc);
             res = (sign_ish & oparg) ? Py_True : Py_False;
             Py_INCREF(res);
         }
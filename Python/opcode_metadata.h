@@ -61,6 +61,18 @@ _PyOpcode_num_popped(int opcode, int oparg, bool jump) {
             return 2;
         case BINARY_OP_SUBTRACT_FLOAT:
             return 2;
+        case BINARY_OP_MULTIPLY_FLOAT_INT:
+            return 2;
+        case BINARY_OP_TRUE_DIVIDE_FLOAT:
+            return 2;
+        case BINARY_OP_FLOOR_DIVIDE_INT:
+            return 2;
+        case BINARY_OP_REMAINDER_INT:
+            return 2;
+        case BINARY_OP_AND_INT:
+            return 2;
+        case BINARY_OP_LSHIFT_INT:
+            return 2;
         case BINARY_OP_ADD_UNICODE:
             return 2;
         case BINARY_OP_INPLACE_ADD_UNICODE:
@@ -449,6 +461,18 @@ _PyOpcode_num_pushed(int opcode, int oparg, bool jump) {
             return 1;
         case BINARY_OP_SUBTRACT_FLOAT:
             return 1;
+        case BINARY_OP_MULTIPLY_FLOAT_INT:
+            return 1;
+        case BINARY_OP_TRUE_DIVIDE_FLOAT:
+            return 1;
+        case BINARY_OP_FLOOR_DIVIDE_INT:
+            return 1;
+        case BINARY_OP_REMAINDER_INT:
+            return 1;
+        case BINARY_OP_AND_INT:
+            return 1;
+        case BINARY_OP_LSHIFT_INT:
+            return 1;
         case BINARY_OP_ADD_UNICODE:
             return 1;
         case BINARY_OP_INPLACE_ADD_UNICODE:
@@ -815,6 +839,12 @@ const struct opcode_metadata _PyOpcode_opcode_metadata[256] = {
     [BINARY_OP_MULTIPLY_FLOAT] = { true, INSTR_FMT_IXC },
     [BINARY_OP_SUBTRACT_INT] = { true, INSTR_FMT_IXC },
     [BINARY_OP_SUBTRACT_FLOAT] = { true, INSTR_FMT_IXC },
+    [BINARY_OP_MULTIPLY_FLOAT_INT] = { true, INSTR_FMT_IXC },
+    [BINARY_OP_TRUE_DIVIDE_FLOAT] = { true, INSTR_FMT_IXC },
+    [BINARY_OP_FLOOR_DIVIDE_INT] = { true, INSTR_FMT_IXC },
+    [BINARY_OP_REMAINDER_INT] = { true, INSTR_FMT_IXC },
+    [BINARY_OP_AND_INT] = { true, INSTR_FMT_IXC },
+    [BINARY_OP_LSHIFT_INT] = { true, INSTR_FMT_IXC },
     [BINARY_OP_ADD_UNICODE] = { true, INSTR_FMT_IXC },
     [BINARY_OP_INPLACE_ADD_UNICODE] = { true, INSTR_FMT_IX },
     [BINARY_OP_ADD_FLOAT] = { true, INSTR_FMT_IXC },
@@ -1690,6 +1690,7 @@ finalize_interp_types(PyInterpreterState *interp)
 
     _PyUnicode_Fini(interp);
     _PyFloat_Fini(interp);
+    _PyLong_Fini(interp);
 #ifdef Py_DEBUG
     _PyStaticObjects_CheckRefcnt(interp);
 #endif
@@ -1945,6 +1945,14 @@ _Py_Specialize_BinaryOp(PyObject *lhs, PyObject *rhs, _Py_CODEUNIT *instr,
         case NB_MULTIPLY:
         case NB_INPLACE_MULTIPLY:
             if (!Py_IS_TYPE(lhs, Py_TYPE(rhs))) {
+                if ((PyFloat_CheckExact(lhs) && PyLong_CheckExact(rhs) &&
+                     _PyLong_IsCompact((PyLongObject *)rhs)) ||
+                    (PyLong_CheckExact(lhs) && PyFloat_CheckExact(rhs) &&
+                     _PyLong_IsCompact((PyLongObject *)lhs)))
+                {
+                    instr->op.code = BINARY_OP_MULTIPLY_FLOAT_INT;
+                    goto success;
+                }
                 break;
             }
             if (PyLong_CheckExact(lhs)) {
@@ -1970,6 +1978,43 @@ _Py_Specialize_BinaryOp(PyObject *lhs, PyObject *rhs, _Py_CODEUNIT *instr,
                 goto success;
             }
             break;
+        case NB_TRUE_DIVIDE:
+        case NB_INPLACE_TRUE_DIVIDE:
+            if (PyFloat_CheckExact(lhs) && PyFloat_CheckExact(rhs)) {
+                instr->op.code = BINARY_OP_TRUE_DIVIDE_FLOAT;
+                goto success;
+            }
+            break;
+        case NB_FLOOR_DIVIDE:
+        case NB_INPLACE_FLOOR_DIVIDE:
+            if (PyLong_CheckExact(lhs) && PyLong_CheckExact(rhs)) {
+                instr->op.code = BINARY_OP_FLOOR_DIVIDE_INT;
+                goto success;
+            }
+            break;
+        case NB_REMAINDER:
+        case NB_INPLACE_REMAINDER:
+            if (PyLong_CheckExact(lhs) && PyLong_CheckExact(rhs)) {
+                instr->op.code = BINARY_OP_REMAINDER_INT;
+                goto success;
+            }
+            break;
+        case NB_AND:
+        case NB_INPLACE_AND:
+            if (PyLong_CheckExact(lhs) && PyLong_CheckExact(rhs)) {
+                instr->op.code = BINARY_OP_AND_INT;
+                goto success;
+            }
+            break;
+        case NB_LSHIFT:
+        case NB_INPLACE_LSHIFT:
+            if (PyLong_CheckExact(lhs) && PyLong_CheckExact(rhs) &&
+                _PyLong_IsNonNegativeCompact((PyLongObject *)rhs))
+            {
+                instr->op.code = BINARY_OP_LSHIFT_INT;
+                goto success;
+            }
+            break;
     }
     SPECIALIZATION_FAIL(BINARY_OP, binary_op_fail_kind(oparg, lhs, rhs));
     STAT_INC(BINARY_OP, failure);